@@ -26,6 +26,16 @@
 #endif
 
 
+#ifndef ENTT_PACKED_PAGE
+#   define ENTT_PACKED_PAGE 1024
+#endif
+
+
+#ifndef ENTT_PARALLEL_CHUNK
+#   define ENTT_PARALLEL_CHUNK 4096
+#endif
+
+
 #ifdef ENTT_DISABLE_ASSERT
 #   undef ENTT_ASSERT
 #   define ENTT_ASSERT(...) (void(0))
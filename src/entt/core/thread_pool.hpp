@@ -0,0 +1,234 @@
+#ifndef ENTT_CORE_THREAD_POOL_HPP
+#define ENTT_CORE_THREAD_POOL_HPP
+
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+
+
+namespace entt {
+
+
+/**
+ * @brief Minimal fork-join thread pool.
+ *
+ * A thread pool is an executor, that is, a function object that accepts a
+ * number of tasks and a job to invoke with the index of each task:
+ *
+ * @code{.cpp}
+ * void(std::size_t count, Job job);
+ * @endcode
+ *
+ * The job is invoked once for each index in `[0, count)`, possibly in parallel
+ * and in any order, and the call returns when all the tasks have completed.
+ * The calling thread takes part in the execution of the tasks.<br/>
+ * Any other type that honors the same contract can be used where an executor
+ * is expected. As an example, an executor based on the standard execution
+ * policies can look like this:
+ *
+ * @code{.cpp}
+ * [](const std::size_t count, auto job) {
+ *     std::vector<std::size_t> task(count);
+ *     std::iota(task.begin(), task.end(), std::size_t{});
+ *     std::for_each(std::execution::par, task.begin(), task.end(), job);
+ * }
+ * @endcode
+ *
+ * Batches submitted concurrently from different threads are executed one at a
+ * time. Batches submitted from within a job run serially on the thread that
+ * submitted them.<br/>
+ * If a task throws, the tasks that haven't started yet are skipped and the
+ * first exception is rethrown once all the threads have left the batch.
+ */
+class thread_pool {
+    struct running_guard {
+        running_guard() ENTT_NOEXCEPT {
+            running() = true;
+        }
+
+        ~running_guard() {
+            running() = false;
+        }
+    };
+
+    [[nodiscard]] static bool & running() ENTT_NOEXCEPT {
+        static thread_local bool value{};
+        return value;
+    }
+
+    template<typename Job>
+    static void invoke(void *job, const std::size_t pos) {
+        (*static_cast<Job *>(job))(pos);
+    }
+
+    void consume() {
+        for(auto pos = next.fetch_add(1u); pos < count; pos = next.fetch_add(1u)) {
+            try {
+                fn(job, pos);
+            } catch(...) {
+                std::lock_guard<std::mutex> lock{mutex};
+                error = error ? error : std::current_exception();
+                // tasks that haven't started yet are skipped
+                next = count;
+            }
+        }
+    }
+
+    void worker() {
+        running() = true;
+        std::size_t seen{};
+
+        for(;;) {
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                wakeup.wait(lock, [this, &seen]() { return stop || generation != seen; });
+
+                if(stop) {
+                    return;
+                }
+
+                seen = generation;
+                ++busy;
+            }
+
+            consume();
+
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+
+                if(--busy == 0u) {
+                    done.notify_all();
+                }
+            }
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a thread pool with the given number of workers.
+     *
+     * By default, the number of workers is such that all the hardware threads
+     * are used when counting the one that submits the tasks.
+     *
+     * @param workers Number of additional threads to spawn.
+     */
+    explicit thread_pool(const size_type workers = (std::max)(std::thread::hardware_concurrency(), 1u) - 1u)
+        : threads{}
+    {
+        threads.reserve(workers);
+
+        for(size_type pos{}; pos < workers; ++pos) {
+            threads.emplace_back(&thread_pool::worker, this);
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    thread_pool(const thread_pool &) = delete;
+
+    /*! @brief Joins all the workers. */
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stop = true;
+        }
+
+        wakeup.notify_all();
+
+        for(auto &&thread: threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This thread pool.
+     */
+    thread_pool & operator=(const thread_pool &) = delete;
+
+    /**
+     * @brief Returns the number of threads that take part in a batch.
+     * @return The number of workers plus the submitting thread.
+     */
+    [[nodiscard]] size_type concurrency() const ENTT_NOEXCEPT {
+        return threads.size() + 1u;
+    }
+
+    /**
+     * @brief Executes a batch of tasks and waits for them to complete.
+     *
+     * If a task throws, the tasks that haven't started yet are skipped and the
+     * first exception is rethrown once all the threads have left the batch.
+     *
+     * @tparam Job Type of job to execute.
+     * @param length Number of tasks in the batch.
+     * @param task A valid function object that accepts a task index.
+     */
+    template<typename Job>
+    void operator()(const size_type length, Job task) {
+        if(threads.empty() || length < 2u || running()) {
+            for(size_type pos{}; pos < length; ++pos) {
+                task(pos);
+            }
+        } else {
+            std::lock_guard<std::mutex> guard{submit};
+
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                // workers still leaving the previous batch must not see this one
+                done.wait(lock, [this]() { return busy == 0u; });
+                fn = &invoke<Job>;
+                job = &task;
+                count = length;
+                next = 0u;
+                ++generation;
+            }
+
+            wakeup.notify_all();
+
+            {
+                running_guard scope{};
+                consume();
+            }
+
+            std::unique_lock<std::mutex> lock{mutex};
+            // workers that wake up late find no tasks left and leave immediately
+            done.wait(lock, [this]() { return busy == 0u; });
+
+            if(error) {
+                std::rethrow_exception(std::exchange(error, nullptr));
+            }
+        }
+    }
+
+private:
+    std::vector<std::thread> threads;
+    std::mutex submit{};
+    std::mutex mutex{};
+    std::condition_variable wakeup{};
+    std::condition_variable done{};
+    void(* fn)(void *, const size_type){};
+    void *job{};
+    size_type count{};
+    std::atomic<size_type> next{};
+    std::exception_ptr error{};
+    size_type generation{};
+    size_type busy{};
+    bool stop{};
+};
+
+
+}
+
+
+#endif
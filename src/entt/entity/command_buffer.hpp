@@ -0,0 +1,260 @@
+#ifndef ENTT_ENTITY_COMMAND_BUFFER_HPP
+#define ENTT_ENTITY_COMMAND_BUFFER_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/type_info.hpp"
+#include "../core/type_traits.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Deferred command buffer.
+ *
+ * A command buffer records mutations of a registry in a set of linear buffers,
+ * one for each type of component, and plays them back later in a single pass
+ * that visits each pool once.<br/>
+ * Command buffers aren't thread safe. The intended use is one buffer for each
+ * thread, all of them played back on the thread that owns the registry once the
+ * parallel work is over.
+ *
+ * Entities created through a command buffer are identifiers reserved from the
+ * registry. They can be used with any buffer and become valid upon playback.
+ *
+ * Commands are grouped by type hash rather than by sequential identifier, so
+ * that buffers can record new types of components from different threads at
+ * the same time.
+ *
+ * @warning
+ * When `ENTT_PRETTY_FUNCTION` isn't available, type hashes fall back to
+ * sequential identifiers and `ENTT_USE_ATOMIC` must be defined to use command
+ * buffers from multiple threads.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_command_buffer final {
+    struct basic_pool_commands {
+        virtual ~basic_pool_commands() = default;
+        virtual void playback(basic_registry<Entity> &) = 0;
+        virtual void clear() ENTT_NOEXCEPT = 0;
+        virtual bool empty() const ENTT_NOEXCEPT = 0;
+    };
+
+    template<typename Component>
+    struct pool_commands final: basic_pool_commands {
+        void playback(basic_registry<Entity> &owner) override {
+            auto value = std::make_move_iterator(values.begin());
+
+            for(auto &&[entt, emplace]: commands) {
+                if(!owner.valid(entt)) {
+                    // discarded commands still consume their values
+                    value += (emplace && !is_empty_v<Component>);
+                } else if(!emplace) {
+                    owner.template remove_if_exists<Component>(entt);
+                } else if constexpr(is_empty_v<Component>) {
+                    owner.template emplace_or_replace<Component>(entt);
+                } else {
+                    owner.template emplace_or_replace<Component>(entt, *(value++));
+                }
+            }
+
+            clear();
+        }
+
+        void clear() ENTT_NOEXCEPT override {
+            commands.clear();
+            values.clear();
+        }
+
+        bool empty() const ENTT_NOEXCEPT override {
+            return commands.empty();
+        }
+
+        std::vector<std::pair<Entity, bool>> commands{};
+        std::vector<Component> values{};
+    };
+
+    template<typename Component>
+    [[nodiscard]] pool_commands<Component> & assure() {
+        // sequential identifiers aren't generated in a thread safe way by default
+        const auto ctype = type_hash<Component>::value();
+        auto it = std::find_if(pools.begin(), pools.end(), [ctype](auto &&pdata) { return pdata.first == ctype; });
+
+        if(it == pools.end()) {
+            it = pools.emplace(pools.end(), ctype, std::make_unique<pool_commands<Component>>());
+        }
+
+        return static_cast<pool_commands<Component> &>(*it->second);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    basic_command_buffer() = default;
+
+    /*! @brief Default move constructor. */
+    basic_command_buffer(basic_command_buffer &&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This command buffer.
+     */
+    basic_command_buffer & operator=(basic_command_buffer &&) = default;
+
+    /**
+     * @brief Records the creation of an entity.
+     *
+     * The returned identifier is reserved from the given registry (see
+     * `reserve_entity` for further details). It can be used to record further
+     * commands with any buffer and it becomes valid upon playback.
+     *
+     * @warning
+     * The registry must not be modified while identifiers are being reserved,
+     * that is, until the buffers stop recording and are played back.
+     *
+     * @param owner The registry to which to apply the commands.
+     * @return The identifier of the entity to create.
+     */
+    [[nodiscard]] entity_type create(basic_registry<entity_type> &owner) {
+        return created.emplace_back(owner.reserve_entity());
+    }
+
+    /**
+     * @brief Records the destruction of an entity.
+     * @param entity A valid entity identifier or a placeholder.
+     */
+    void destroy(const entity_type entity) {
+        destroyed.push_back(entity);
+    }
+
+    /**
+     * @brief Records the assignment of a component to an entity.
+     *
+     * The component is created immediately and moved into the registry upon
+     * playback. If the entity already owns the component, it's replaced.
+     *
+     * @tparam Component Type of component to create.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param entity A valid entity identifier or a placeholder.
+     * @param args Parameters to use to initialize the component.
+     */
+    template<typename Component, typename... Args>
+    void emplace(const entity_type entity, Args &&... args) {
+        auto &cpool = assure<Component>();
+
+        if constexpr(!is_empty_v<Component>) {
+            if constexpr(std::is_aggregate_v<Component>) {
+                cpool.values.push_back(Component{std::forward<Args>(args)...});
+            } else {
+                cpool.values.emplace_back(std::forward<Args>(args)...);
+            }
+        }
+
+        cpool.commands.emplace_back(entity, true);
+    }
+
+    /**
+     * @brief Records the removal of the given components from an entity.
+     *
+     * Components that the entity doesn't own upon playback are ignored.
+     *
+     * @tparam Component Types of components to remove.
+     * @param entity A valid entity identifier or a placeholder.
+     */
+    template<typename... Component>
+    void remove(const entity_type entity) {
+        static_assert(sizeof...(Component) > 0);
+        (assure<Component>().commands.emplace_back(entity, false), ...);
+    }
+
+    /**
+     * @brief Checks whether a command buffer is empty.
+     * @return True if the command buffer is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return created.empty() && destroyed.empty() && std::all_of(pools.cbegin(), pools.cend(), [](auto &&pdata) { return pdata.second->empty(); });
+    }
+
+    /**
+     * @brief Discards all the commands recorded so far.
+     *
+     * Identifiers reserved by the buffer can't be given back. The entities
+     * created through the buffer are destroyed upon the next playback instead.
+     */
+    void clear() {
+        for(auto &&pdata: pools) {
+            pdata.second->clear();
+        }
+
+        discarded.insert(discarded.end(), created.cbegin(), created.cend());
+        destroyed.clear();
+        created.clear();
+    }
+
+    /**
+     * @brief Plays back all the commands recorded so far and clears the buffer.
+     *
+     * Commands are applied in batches:
+     *
+     * * All the reserved entities are made valid at once.
+     * * The commands for each type of component are applied pool by pool, in
+     *   the order in which they were recorded.
+     * * All the entities are destroyed at once.
+     *
+     * Commands that refer to entities that are no longer valid upon playback
+     * are discarded.
+     *
+     * @param owner The registry to which to apply the commands.
+     */
+    void playback(basic_registry<entity_type> &owner) {
+        // reservations are committed as a whole, including those of other buffers
+        owner.commit_reserved();
+
+        for(auto &&pdata: pools) {
+            if(!pdata.second->empty()) {
+                pdata.second->playback(owner);
+            }
+        }
+
+        destroyed.insert(destroyed.end(), discarded.cbegin(), discarded.cend());
+        auto last = std::remove_if(destroyed.begin(), destroyed.end(), [&owner](const auto entt) { return !owner.valid(entt); });
+
+        // the same entity can be destroyed more than once
+        std::sort(destroyed.begin(), last);
+        last = std::unique(destroyed.begin(), last);
+        owner.destroy(destroyed.begin(), last);
+
+        destroyed.clear();
+        discarded.clear();
+        created.clear();
+    }
+
+private:
+    std::vector<std::pair<id_type, std::unique_ptr<basic_pool_commands>>> pools{};
+    std::vector<entity_type> destroyed{};
+    std::vector<entity_type> discarded{};
+    std::vector<entity_type> created{};
+};
+
+
+}
+
+
+#endif
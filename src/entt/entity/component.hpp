@@ -0,0 +1,100 @@
+#ifndef ENTT_ENTITY_COMPONENT_HPP
+#define ENTT_ENTITY_COMPONENT_HPP
+
+
+#include <type_traits>
+
+
+namespace entt {
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename, typename = void>
+struct in_place_delete: std::false_type {};
+
+template<typename Type>
+struct in_place_delete<Type, std::enable_if_t<Type::in_place_delete>>: std::true_type {};
+
+
+template<typename, typename = void>
+struct track_changes: std::false_type {};
+
+template<typename Type>
+struct track_changes<Type, std::enable_if_t<Type::track_changes>>: std::true_type {};
+
+
+template<typename, typename = void>
+struct paged_packed: std::false_type {};
+
+template<typename Type>
+struct paged_packed<Type, std::enable_if_t<Type::paged_packed>>: std::true_type {};
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
+/**
+ * @brief Commonly used default traits for all types.
+ *
+ * Users can specialize this class template to customize how components are
+ * managed by the storage classes.<br/>
+ * By default, a type opts in for a feature by exposing a static constexpr data
+ * member with the same name that evaluates to true.
+ *
+ * @tparam Type Type of component.
+ */
+template<typename Type, typename = void>
+struct component_traits {
+    static_assert(std::is_same_v<std::decay_t<Type>, Type>, "Unsupported type");
+
+    /*! @brief Pointer stability, default is swap-and-pop deletion. */
+    static constexpr bool in_place_delete = internal::in_place_delete<Type>::value;
+    /*! @brief Change tracking, default is no change ticks. */
+    static constexpr bool track_changes = internal::track_changes<Type>::value;
+    /*! @brief Paged packed array, default is a contiguous one (implied by in-place deletion). */
+    static constexpr bool paged_packed = internal::paged_packed<Type>::value || in_place_delete;
+};
+
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<typename Type>
+inline constexpr bool in_place_delete_v = component_traits<Type>::in_place_delete;
+
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<typename Type>
+inline constexpr bool track_changes_v = component_traits<Type>::track_changes;
+
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Type of component.
+ */
+template<typename Type>
+inline constexpr bool paged_packed_v = component_traits<Type>::paged_packed;
+
+
+}
+
+
+#endif
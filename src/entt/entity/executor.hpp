@@ -0,0 +1,312 @@
+#ifndef ENTT_ENTITY_EXECUTOR_HPP
+#define ENTT_ENTITY_EXECUTOR_HPP
+
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+#include "organizer.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Work stealing executor for the task graphs of an organizer.
+ *
+ * The executor consumes the adjacency list returned by an organizer. Top-level
+ * vertices are started first, while all the other vertices are released as
+ * soon as the tasks they depend on have completed.<br/>
+ * Each thread has its own queue of ready tasks. Tasks released by a thread are
+ * pushed to its queue and idle threads steal them from the queues of the
+ * others. Threads are created once and reused across runs.
+ *
+ * Creating resources within a registry isn't thread safe. Vertices should be
+ * prepared before running a graph for the first time (see the `prepare` member
+ * function of the vertex type of an organizer).
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_executor final {
+    struct task_queue {
+        std::mutex mutex{};
+        std::deque<std::size_t> tasks{};
+    };
+
+    [[nodiscard]] bool pop(const std::size_t index, std::size_t &task) {
+        auto &curr = queues[index];
+        std::lock_guard<std::mutex> lock{curr.mutex};
+
+        if(curr.tasks.empty()) {
+            return false;
+        }
+
+        task = curr.tasks.back();
+        curr.tasks.pop_back();
+        --queued;
+        return true;
+    }
+
+    [[nodiscard]] bool steal(const std::size_t index, std::size_t &task) {
+        const auto length = threads.size() + 1u;
+
+        for(std::size_t next = (index + 1u) % length; next != index; next = (next + 1u) % length) {
+            auto &curr = queues[next];
+            std::lock_guard<std::mutex> lock{curr.mutex};
+
+            if(!curr.tasks.empty()) {
+                task = curr.tasks.front();
+                curr.tasks.pop_front();
+                --queued;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void push(const std::size_t index, const std::size_t task) {
+        auto &curr = queues[index];
+        std::lock_guard<std::mutex> lock{curr.mutex};
+        curr.tasks.push_back(task);
+        ++queued;
+    }
+
+    void invoke(const std::size_t task) {
+        const auto &vertex = graph[task];
+
+        // once a task has thrown, the others are only released to drain the graph
+        if(!cancelled.load(std::memory_order_acquire)) {
+            try {
+                vertex.callback()(vertex.data(), *reg);
+            } catch(...) {
+                std::lock_guard<std::mutex> lock{mutex};
+                error = error ? error : std::current_exception();
+                cancelled.store(true, std::memory_order_release);
+            }
+        }
+    }
+
+    void execute(const std::size_t index) {
+        std::size_t task{};
+
+        while(remaining.load(std::memory_order_acquire) != 0u) {
+            if(pop(index, task) || steal(index, task)) {
+                std::size_t released{};
+
+                invoke(task);
+
+                for(const auto child: graph[task].children()) {
+                    if(pending[child].fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+                        push(index, child);
+                        ++released;
+                    }
+                }
+
+                if(remaining.fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    ready.notify_all();
+                } else if(released > 1u && sleeping != 0u) {
+                    // the first task released is left to this thread
+                    std::lock_guard<std::mutex> lock{mutex};
+                    released == 2u ? ready.notify_one() : ready.notify_all();
+                }
+            } else {
+                // idle threads are parked until tasks are released or the run is over
+                std::unique_lock<std::mutex> lock{mutex};
+                ++sleeping;
+                ready.wait(lock, [this]() { return queued != 0u || remaining.load(std::memory_order_acquire) == 0u; });
+                --sleeping;
+            }
+        }
+    }
+
+    void worker(const std::size_t index) {
+        std::size_t seen{};
+
+        for(;;) {
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                wakeup.wait(lock, [this, &seen]() { return stop || generation != seen; });
+
+                if(stop) {
+                    return;
+                }
+
+                seen = generation;
+                ++busy;
+            }
+
+            execute(index);
+
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+
+                if(--busy == 0u) {
+                    done.notify_all();
+                }
+            }
+        }
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Vertex type of the task graphs. */
+    using vertex_type = typename basic_organizer<Entity>::vertex;
+
+    /**
+     * @brief Constructs an executor with the given number of workers.
+     *
+     * By default, the number of workers is such that all the hardware threads
+     * are used when counting the one that runs the graph.
+     *
+     * @param workers Number of additional threads to spawn.
+     */
+    explicit basic_executor(const size_type workers = (std::max)(std::thread::hardware_concurrency(), 1u) - 1u)
+        : threads{},
+          queues{std::make_unique<task_queue[]>(workers + 1u)}
+    {
+        threads.reserve(workers);
+
+        for(size_type pos{}; pos < workers; ++pos) {
+            threads.emplace_back(&basic_executor::worker, this, pos + 1u);
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_executor(const basic_executor &) = delete;
+
+    /*! @brief Joins all the workers. */
+    ~basic_executor() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stop = true;
+        }
+
+        wakeup.notify_all();
+
+        for(auto &&thread: threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This executor.
+     */
+    basic_executor & operator=(const basic_executor &) = delete;
+
+    /**
+     * @brief Returns the number of threads that take part in a run.
+     * @return The number of workers plus the thread that runs the graph.
+     */
+    [[nodiscard]] size_type concurrency() const ENTT_NOEXCEPT {
+        return threads.size() + 1u;
+    }
+
+    /**
+     * @brief Runs a task graph and waits for all its tasks to complete.
+     *
+     * If a task throws, the tasks that haven't started yet are skipped and the
+     * first exception is rethrown once all the threads have left the graph.
+     *
+     * @warning
+     * Running a graph from within one of its tasks results in undefined
+     * behavior.
+     *
+     * @param tasks The adjacency list of a task graph.
+     * @param owner The registry to pass to the tasks.
+     */
+    void run(const std::vector<vertex_type> &tasks, basic_registry<entity_type> &owner) {
+        if(tasks.empty()) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard{submit};
+
+        if(tasks.size() > capacity) {
+            pending = std::make_unique<std::atomic<size_type>[]>(tasks.size());
+            capacity = tasks.size();
+        }
+
+        for(size_type pos{}, last = tasks.size(); pos < last; ++pos) {
+            pending[pos].store(0u, std::memory_order_relaxed);
+        }
+
+        for(auto &&vertex: tasks) {
+            for(const auto child: vertex.children()) {
+                pending[child].fetch_add(1u, std::memory_order_relaxed);
+            }
+        }
+
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            // workers still leaving the previous run must not see this one
+            done.wait(lock, [this]() { return busy == 0u; });
+            graph = tasks.data();
+            reg = &owner;
+
+            for(size_type pos{}, next{}, last = tasks.size(); pos < last; ++pos) {
+                if(pending[pos].load(std::memory_order_relaxed) == 0u) {
+                    // spreads top-level tasks among all the threads
+                    push(next++ % concurrency(), pos);
+                }
+            }
+
+            remaining.store(tasks.size(), std::memory_order_release);
+            ++generation;
+        }
+
+        wakeup.notify_all();
+        execute(0u);
+
+        std::unique_lock<std::mutex> lock{mutex};
+        done.wait(lock, [this]() { return busy == 0u; });
+        cancelled.store(false, std::memory_order_relaxed);
+
+        if(error) {
+            std::rethrow_exception(std::exchange(error, nullptr));
+        }
+    }
+
+private:
+    std::vector<std::thread> threads;
+    std::unique_ptr<task_queue[]> queues;
+    std::unique_ptr<std::atomic<size_type>[]> pending{};
+    size_type capacity{};
+    const vertex_type *graph{};
+    basic_registry<entity_type> *reg{};
+    std::atomic<size_type> remaining{};
+    std::atomic<size_type> queued{};
+    std::atomic<size_type> sleeping{};
+    std::atomic<bool> cancelled{};
+    std::exception_ptr error{};
+    std::mutex submit{};
+    std::mutex mutex{};
+    std::condition_variable wakeup{};
+    std::condition_variable ready{};
+    std::condition_variable done{};
+    size_type generation{};
+    size_type busy{};
+    bool stop{};
+};
+
+
+}
+
+
+#endif
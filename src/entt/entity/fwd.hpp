@@ -2,12 +2,17 @@
 #define ENTT_ENTITY_FWD_HPP
 
 
+#include <cstdint>
 #include "../core/fwd.hpp"
 
 
 namespace entt {
 
 
+/*! @brief Alias declaration for the type of change ticks. */
+using tick_type = std::uint32_t;
+
+
 template<typename>
 class basic_sparse_set;
 
@@ -40,6 +45,18 @@ template<typename>
 class basic_organizer;
 
 
+template<typename>
+class basic_executor;
+
+
+template<typename>
+class basic_command_buffer;
+
+
+template<typename>
+class basic_rollback;
+
+
 template<typename, typename...>
 struct basic_handle;
 
@@ -56,6 +73,22 @@ template<typename>
 class basic_continuous_loader;
 
 
+template<typename>
+class basic_delta_snapshot;
+
+
+template<typename>
+class basic_binary_snapshot;
+
+
+template<typename>
+class basic_binary_snapshot_loader;
+
+
+template<typename>
+class basic_mapped_snapshot_loader;
+
+
 /*! @brief Default entity identifier. */
 enum class entity: id_type {};
 
@@ -84,6 +117,18 @@ using observer = basic_observer<entity>;
 using organizer = basic_organizer<entity>;
 
 
+/*! @brief Alias declaration for the most common use case. */
+using executor = basic_executor<entity>;
+
+
+/*! @brief Alias declaration for the most common use case. */
+using command_buffer = basic_command_buffer<entity>;
+
+
+/*! @brief Alias declaration for the most common use case. */
+using rollback = basic_rollback<entity>;
+
+
 /*! @brief Alias declaration for the most common use case. */
 using handle = basic_handle<entity>;
 
@@ -120,6 +165,22 @@ using snapshot_loader = basic_snapshot_loader<entity>;
 using continuous_loader = basic_continuous_loader<entity>;
 
 
+/*! @brief Alias declaration for the most common use case. */
+using delta_snapshot = basic_delta_snapshot<entity>;
+
+
+/*! @brief Alias declaration for the most common use case. */
+using binary_snapshot = basic_binary_snapshot<entity>;
+
+
+/*! @brief Alias declaration for the most common use case. */
+using binary_snapshot_loader = basic_binary_snapshot_loader<entity>;
+
+
+/*! @brief Alias declaration for the most common use case. */
+using mapped_snapshot_loader = basic_mapped_snapshot_loader<entity>;
+
+
 /**
  * @brief Alias declaration for the most common use case.
  * @tparam Args Other template parameters.
@@ -2,6 +2,7 @@
 #define ENTT_ENTITY_GROUP_HPP
 
 
+#include <algorithm>
 #include <tuple>
 #include <utility>
 #include <type_traits>
@@ -400,6 +401,57 @@ public:
         return iterable_group{handler, pools};
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The group is split in chunks of contiguous elements. Chunks are then
+     * submitted as tasks to the given executor, that is a function object with
+     * a signature equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, Job job);
+     * @endcode
+     *
+     * The executor must invoke `job` once for each index in `[0, count)` and
+     * return only once all the tasks have completed (see `thread_pool` for a
+     * built-in executor).
+     *
+     * @warning
+     * The function object is invoked concurrently from multiple threads and is
+     * shared among all of them. Adding or removing components and entities
+     * during the iteration results in undefined behavior.
+     *
+     * @sa each
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @tparam Exec Type of executor.
+     * @param func A valid function object.
+     * @param exec A valid executor.
+     * @param chunk Number of elements per task.
+     */
+    template<typename Func, typename Exec>
+    void par_each(Func func, Exec &&exec, const size_type chunk = ENTT_PARALLEL_CHUNK) const {
+        ENTT_ASSERT(chunk);
+
+        if(*this) {
+            const auto length = handler->size();
+
+            exec((length + chunk - 1u) / chunk, [this, &func, length, chunk](const size_type task) {
+                const auto from = task * chunk;
+                const auto last = handler->begin() + (std::min)(length, from + chunk);
+
+                for(auto first = handler->begin() + from; first != last; ++first) {
+                    if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
+                        std::apply(func, std::tuple_cat(std::make_tuple(*first), get(*first)));
+                    } else {
+                        std::apply(func, get(*first));
+                    }
+                }
+            });
+        }
+    }
+
     /**
      * @brief Sort a group according to the given comparison function.
      *
@@ -640,6 +692,14 @@ class basic_group<Entity, exclude_t<Exclude...>, get_t<Get...>, Owned...> final
         }
 
     private:
+        [[nodiscard]] iterator at(const std::size_t pos) const ENTT_NOEXCEPT {
+            return iterator{
+                std::get<0>(pools)->basic_sparse_set<Entity>::end() - *length + pos,
+                std::make_tuple((std::get<storage_type<Owned> *>(pools)->end() - *length + pos)...),
+                std::make_tuple(std::get<storage_type<Get> *>(pools)...)
+            };
+        }
+
         const std::tuple<storage_type<Owned> *..., storage_type<Get> *...> pools;
         const std::size_t * const length;
     };
@@ -686,6 +746,8 @@ public:
      * The returned pointer is such that range
      * `[raw<Component>(), raw<Component>() + size())` is always a valid range,
      * even if the container is empty.<br/>
+     * For types with a paged packed array, the returned pointer refers to the
+     * array of pages instead (see the `raw` function of the storage classes).
      *
      * @warning
      * This function is only available for owned types.
@@ -694,7 +756,7 @@ public:
      * @return A pointer to the array of components.
      */
     template<typename Component>
-    [[nodiscard]] Component * raw() const ENTT_NOEXCEPT {
+    [[nodiscard]] auto raw() const ENTT_NOEXCEPT {
         static_assert((std::is_same_v<Component, Owned> || ...));
         auto *cpool = std::get<storage_type<Component> *>(pools);
         return cpool ? cpool->raw() : nullptr;
@@ -900,6 +962,50 @@ public:
         return iterable_group{pools, length};
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The range of owned elements is split in chunks of contiguous elements
+     * that are submitted as tasks to the given executor. See the non-owning
+     * group for the requirements of an executor.
+     *
+     * @warning
+     * The function object is invoked concurrently from multiple threads and is
+     * shared among all of them. Adding or removing components and entities
+     * during the iteration results in undefined behavior.
+     *
+     * @sa each
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @tparam Exec Type of executor.
+     * @param func A valid function object.
+     * @param exec A valid executor.
+     * @param chunk Number of elements per task.
+     */
+    template<typename Func, typename Exec>
+    void par_each(Func func, Exec &&exec, const size_type chunk = ENTT_PARALLEL_CHUNK) const {
+        ENTT_ASSERT(chunk);
+
+        if(*this) {
+            const auto iterable = each();
+            const auto extent = *length;
+
+            exec((extent + chunk - 1u) / chunk, [&iterable, &func, extent, chunk](const size_type task) {
+                const auto from = task * chunk;
+                const auto last = iterable.at((std::min)(extent, from + chunk));
+
+                for(auto first = iterable.at(from); first != last; ++first) {
+                    if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
+                        std::apply(func, *first);
+                    } else {
+                        std::apply([&func](auto, auto &&... less) { func(std::forward<decltype(less)>(less)...); }, *first);
+                    }
+                }
+            });
+        }
+    }
+
     /**
      * @brief Sort a group according to the given comparison function.
      *
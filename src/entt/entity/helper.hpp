@@ -2,10 +2,14 @@
 #define ENTT_ENTITY_HELPER_HPP
 
 
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <type_traits>
 #include "../config/config.h"
 #include "../core/type_traits.hpp"
 #include "../signal/delegate.hpp"
+#include "component.hpp"
 #include "registry.hpp"
 #include "fwd.hpp"
 
@@ -137,6 +141,15 @@ void invoke(basic_registry<Entity> &reg, const Entity entt) {
 
 /**
  * @brief Returns the entity associated with a given component.
+ *
+ * @warning
+ * Currently, this function only works correctly with the default pool as it
+ * makes assumptions about how the components are laid out.
+ *
+ * @note
+ * For types with a paged packed array, the search is linear in the number of
+ * pages of the pool.
+ *
  * @tparam Entity A valid entity type (see entt_traits for more details).
  * @tparam Component Type of component.
  * @param reg A registry that contains the given entity and its components.
@@ -146,7 +159,23 @@ void invoke(basic_registry<Entity> &reg, const Entity entt) {
 template<typename Entity, typename Component>
 Entity to_entity(const basic_registry<Entity> &reg, const Component &component) {
     const auto view = reg.template view<const Component>();
-    return *(view.data() + (&component - view.raw()));
+    const auto *addr = std::addressof(component);
+
+    // unrelated allocations are only totally ordered by std::less
+    const std::less<const Component *> less{};
+
+    if constexpr(component_traits<Component>::paged_packed) {
+        for(std::size_t pos{}, last = view.size(); pos < last; pos += ENTT_PACKED_PAGE) {
+            if(const auto *first = view.raw()[pos / ENTT_PACKED_PAGE]; !less(addr, first) && less(addr, first + ENTT_PACKED_PAGE)) {
+                const auto curr = pos + static_cast<std::size_t>(addr - first);
+                return curr < last ? view.data()[curr] : null;
+            }
+        }
+    } else if(const auto *first = view.raw(); !less(addr, first) && less(addr, first + view.size())) {
+        return view.data()[addr - first];
+    }
+
+    return null;
 }
 
 
@@ -3,7 +3,9 @@
 
 
 #include <cstddef>
+#include <cstdint>
 #include <algorithm>
+#include <limits>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -117,7 +119,8 @@ resource<type_list<>, type_list<Req...>> to_resource();
  * an execution graph from functions and their requirements on resources.<br/>
  * Note that the resulting tasks aren't executed in any case. This isn't the
  * goal of the tool. Instead, they are returned to the user in the form of a
- * graph that allows for safe execution.
+ * graph that allows for safe execution.<br/>
+ * See the executor class template for a tool that runs a graph concurrently.
  *
  * @tparam Entity A valid entity type (see entt_traits for more details).
  */
@@ -173,11 +176,17 @@ class basic_organizer final {
         (dependencies[type_hash<RW>::value()].emplace_back(index, true), ...);
     }
 
-    [[nodiscard]] std::vector<bool> adjacency_matrix() {
+    [[nodiscard]] std::vector<std::vector<std::size_t>> adjacency_list() {
+        constexpr auto bits = std::numeric_limits<std::uint64_t>::digits;
         const auto length = vertices.size();
-        std::vector<bool> edges(length * length, false);
+        const auto words = (length + bits - 1u) / bits;
+        std::vector<std::uint64_t> edges(length * words, 0u);
 
-        // creates the ajacency matrix
+        const auto connect = [&edges, words](const std::size_t from, const std::size_t to) {
+            edges[from * words + to / bits] |= std::uint64_t{1u} << (to % bits);
+        };
+
+        // creates the adjacency matrix
         for(const auto &deps: dependencies) {
             const auto last = deps.second.cend();
             auto it = deps.second.cbegin();
@@ -187,16 +196,16 @@ class basic_organizer final {
                     // rw item
                     if(auto curr = it++; it != last) {
                         if(it->second) {
-                            edges[curr->first * length + it->first] = true;
+                            connect(curr->first, it->first);
                         } else {
                             if(const auto next = std::find_if(it, last, [](const auto &elem) { return elem.second; }); next != last) {
                                 for(; it != next; ++it) {
-                                    edges[curr->first * length + it->first] = true;
-                                    edges[it->first * length + next->first] = true;
+                                    connect(curr->first, it->first);
+                                    connect(it->first, next->first);
                                 }
                             } else {
                                 for(; it != next; ++it) {
-                                    edges[curr->first * length + it->first] = true;
+                                    connect(curr->first, it->first);
                                 }
                             }
                         }
@@ -205,7 +214,7 @@ class basic_organizer final {
                     // ro item, possibly only on first iteration
                     if(const auto next = std::find_if(it, last, [](const auto &elem) { return elem.second; }); next != last) {
                         for(; it != next; ++it) {
-                            edges[it->first * length + next->first] = true;
+                            connect(it->first, next->first);
                         }
                     } else {
                         it = last;
@@ -214,33 +223,34 @@ class basic_organizer final {
             }
         }
 
-        // computes the transitive closure
-        for(std::size_t vk{}; vk < length; ++vk) {
-            for(std::size_t vi{}; vi < length; ++vi) {
-                for(std::size_t vj{}; vj < length; ++vj) {
-                    edges[vi * length + vj] = edges[vi * length + vj] || (edges[vi * length + vk] && edges[vk * length + vj]);
-                }
-            }
-        }
+        // edges only go from a vertex to the ones that follow it, the insertion order is a topological order
+        std::vector<std::uint64_t> reachable(length * words, 0u);
+        std::vector<std::vector<std::size_t>> adjacency(length);
 
-        // applies the transitive reduction
-        for(std::size_t vert{}; vert < length; ++vert) {
-            edges[vert * length + vert] = false;
-        }
+        // applies the transitive reduction in reverse topological order, one word of vertices at a time
+        for(auto vert = length; vert--;) {
+            const auto row = vert * words;
+
+            for(std::size_t word{}; word < words; ++word) {
+                std::size_t next = word * bits;
+
+                for(auto mask = edges[row + word]; mask; mask >>= 1u, ++next) {
+                    const auto bit = std::uint64_t{1u} << (next % bits);
+
+                    // children are visited in order, those reachable through a previous child are redundant
+                    if((mask & 1u) && next != vert && !(reachable[row + word] & bit)) {
+                        adjacency[vert].push_back(next);
+                        reachable[row + word] |= bit;
 
-        for(std::size_t vj{}; vj < length; ++vj) {
-            for(std::size_t vi{}; vi < length; ++vi) {
-                if(edges[vi * length + vj]) {
-                    for(std::size_t vk{}; vk < length; ++vk) {
-                        if(edges[vj * length + vk]) {
-                            edges[vi * length + vk] = false;
+                        for(auto curr = word; curr < words; ++curr) {
+                            reachable[row + curr] |= reachable[next * words + curr];
                         }
                     }
                 }
             }
         }
 
-        return edges;
+        return adjacency;
     }
 
 public:
@@ -464,28 +474,21 @@ public:
      * @return The adjacency list of the task graph.
      */
     std::vector<vertex> graph() {
-        const auto edges = adjacency_matrix();
+        auto edges = adjacency_list();
+        std::vector<bool> is_top_level(vertices.size(), true);
+
+        for(auto &&reachable: edges) {
+            for(const auto next: reachable) {
+                is_top_level[next] = false;
+            }
+        }
 
         // creates the adjacency list
         std::vector<vertex> adjacency_list{};
         adjacency_list.reserve(vertices.size());
 
-        for(std::size_t col{}, length = vertices.size(); col < length; ++col) {
-            std::vector<std::size_t> reachable{};
-            const auto row = col * length;
-            bool is_top_level = true;
-
-            for(std::size_t next{}; next < length; ++next) {
-                if(edges[row + next]) {
-                    reachable.push_back(next);
-                }
-            }
-
-            for(std::size_t next{}; next < length && is_top_level; ++next) {
-                is_top_level = !edges[next * length + col];
-            }
-
-            adjacency_list.emplace_back(is_top_level, vertices[col], std::move(reachable));
+        for(std::size_t pos{}, length = vertices.size(); pos < length; ++pos) {
+            adjacency_list.emplace_back(is_top_level[pos], vertices[pos], std::move(edges[pos]));
         }
 
         return adjacency_list;
@@ -3,10 +3,12 @@
 
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -16,6 +18,7 @@
 #include "../core/fwd.hpp"
 #include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
+#include "component.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 #include "group.hpp"
@@ -51,6 +54,7 @@ class basic_registry {
     struct pool_data {
         poly_storage_type poly;
         std::unique_ptr<basic_sparse_set<Entity>> pool{};
+        void(* clone)(const basic_sparse_set<Entity> *, pool_data &){};
     };
 
     template<typename...>
@@ -62,34 +66,46 @@ class basic_registry {
         std::conditional_t<sizeof...(Owned) == 0, basic_sparse_set<Entity>, std::size_t> current{};
 
         template<typename Component>
-        void maybe_valid_if(basic_registry &owner, const Entity entt) {
+        void maybe_valid_if(basic_registry &owner, const Entity *first, const Entity *last) {
             [[maybe_unused]] const auto cpools = std::make_tuple(owner.assure<Owned>()...);
-
-            const auto is_valid = ((std::is_same_v<Component, Owned> || std::get<storage_type<Owned> *>(cpools)->contains(entt)) && ...)
-                    && ((std::is_same_v<Component, Get> || owner.assure<Get>()->contains(entt)) && ...)
-                    && ((std::is_same_v<Component, Exclude> || !owner.assure<Exclude>()->contains(entt)) && ...);
-
-            if constexpr(sizeof...(Owned) == 0) {
-                if(is_valid && !current.contains(entt)) {
-                    current.emplace(entt);
-                }
-            } else {
-                if(is_valid && !(std::get<0>(cpools)->index(entt) < current)) {
-                    const auto pos = current++;
-                    (std::get<storage_type<Owned> *>(cpools)->swap(std::get<storage_type<Owned> *>(cpools)->data()[pos], entt), ...);
+            [[maybe_unused]] const auto gpools = std::make_tuple(owner.assure<Get>()...);
+            [[maybe_unused]] const auto epools = std::make_tuple(owner.assure<Exclude>()...);
+
+            for(; first != last; ++first) {
+                const auto entt = *first;
+
+                const auto is_valid = ((std::is_same_v<Component, Owned> || std::get<storage_type<Owned> *>(cpools)->contains(entt)) && ...)
+                        && ((std::is_same_v<Component, Get> || std::get<storage_type<Get> *>(gpools)->contains(entt)) && ...)
+                        && ((std::is_same_v<Component, Exclude> || !std::get<storage_type<Exclude> *>(epools)->contains(entt)) && ...);
+
+                if constexpr(sizeof...(Owned) == 0) {
+                    if(is_valid && !current.contains(entt)) {
+                        current.emplace(entt);
+                    }
+                } else {
+                    if(is_valid && !(std::get<0>(cpools)->index(entt) < current)) {
+                        const auto pos = current++;
+                        (std::get<storage_type<Owned> *>(cpools)->swap(std::get<storage_type<Owned> *>(cpools)->data()[pos], entt), ...);
+                    }
                 }
             }
         }
 
-        void discard_if([[maybe_unused]] basic_registry &owner, const Entity entt) {
-            if constexpr(sizeof...(Owned) == 0) {
-                if(current.contains(entt)) {
-                    current.remove(entt);
-                }
-            } else {
-                if(const auto cpools = std::make_tuple(owner.assure<Owned>()...); std::get<0>(cpools)->contains(entt) && (std::get<0>(cpools)->index(entt) < current)) {
-                    const auto pos = --current;
-                    (std::get<storage_type<Owned> *>(cpools)->swap(std::get<storage_type<Owned> *>(cpools)->data()[pos], entt), ...);
+        void discard_if([[maybe_unused]] basic_registry &owner, const Entity *first, const Entity *last) {
+            [[maybe_unused]] const auto cpools = std::make_tuple(owner.assure<Owned>()...);
+
+            for(; first != last; ++first) {
+                const auto entt = *first;
+
+                if constexpr(sizeof...(Owned) == 0) {
+                    if(current.contains(entt)) {
+                        current.remove(entt);
+                    }
+                } else {
+                    if(std::get<0>(cpools)->contains(entt) && (std::get<0>(cpools)->index(entt) < current)) {
+                        const auto pos = --current;
+                        (std::get<storage_type<Owned> *>(cpools)->swap(std::get<storage_type<Owned> *>(cpools)->data()[pos], entt), ...);
+                    }
                 }
             }
         }
@@ -103,9 +119,54 @@ class basic_registry {
         bool (* exclude)(const id_type) ENTT_NOEXCEPT;
     };
 
+    // context variables are stored in fixed size pages to keep their addresses stable
+    static constexpr std::size_t variable_page = 32u;
+
     struct variable_data {
-        type_info info;
-        std::unique_ptr<void, void(*)(void *)> value;
+        variable_data() = default;
+        variable_data(const variable_data &) = delete;
+        variable_data & operator=(const variable_data &) = delete;
+
+        ~variable_data() {
+            reset();
+        }
+
+        void reset() {
+            if(instance) {
+                destroy(instance);
+                instance = nullptr;
+            }
+        }
+
+        type_info info{};
+        void *instance{};
+        void(* destroy)(void *){};
+        std::aligned_storage_t<sizeof(double[2])> storage;
+    };
+
+    struct reserved_data {
+        // all bits set, never a valid head for the list of destroyed entities
+        static constexpr auto unused = ~typename traits_type::entity_type{};
+
+        reserved_data() = default;
+
+        reserved_data(reserved_data &&other) ENTT_NOEXCEPT
+            : head{other.head.load(std::memory_order_relaxed)},
+              fresh{other.fresh.load(std::memory_order_relaxed)}
+        {}
+
+        reserved_data & operator=(reserved_data &&other) ENTT_NOEXCEPT {
+            head.store(other.head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            fresh.store(other.fresh.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+
+        [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+            return head.load(std::memory_order_relaxed) == unused && !fresh.load(std::memory_order_relaxed);
+        }
+
+        std::atomic<typename traits_type::entity_type> head{unused};
+        std::atomic<std::size_t> fresh{};
     };
 
     template<typename Component>
@@ -119,6 +180,24 @@ class basic_registry {
         if(auto &&pdata = pools[index]; !pdata.pool) {
             pdata.pool.reset(new storage_type<Component>());
             pdata.poly = std::ref(*static_cast<storage_type<Component> *>(pdata.pool.get()));
+
+            if constexpr(std::is_copy_constructible_v<Component> && std::is_copy_constructible_v<storage_type<Component>>) {
+                pdata.clone = [](const basic_sparse_set<Entity> *cpool, pool_data &other) {
+                    // a null source is copied as an empty pool, so that the target keeps its memory
+                    const storage_type<Component> empty{};
+                    const auto &source = cpool ? static_cast<const storage_type<Component> &>(*cpool) : empty;
+
+                    if constexpr(std::is_copy_assignable_v<storage_type<Component>>) {
+                        if(other.pool) {
+                            *static_cast<storage_type<Component> *>(other.pool.get()) = source;
+                            return;
+                        }
+                    }
+
+                    other.pool.reset(new storage_type<Component>(source));
+                    other.poly = std::ref(*static_cast<storage_type<Component> *>(other.pool.get()));
+                };
+            }
         }
 
         return static_cast<storage_type<Component> *>(pools[index].pool.get());
@@ -130,14 +209,28 @@ class basic_registry {
         return (!(index < pools.size()) || !pools[index].pool) ? nullptr : static_cast<const storage_type<Component> *>(pools[index].pool.get());
     }
 
+    [[nodiscard]] const variable_data * variable(const id_type index) const {
+        const auto page = size_type{index} / variable_page;
+        return (page < vars.size() && vars[page]) ? &vars[page][size_type{index} % variable_page] : nullptr;
+    }
+
+    void clone_pool(const std::size_t index, basic_registry &other) const {
+        if(const auto &pdata = pools[index]; pdata.pool) {
+            ENTT_ASSERT(pdata.clone);
+            pdata.clone(pdata.pool.get(), other.pools[index]);
+            other.pools[index].clone = pdata.clone;
+        }
+    }
+
     Entity generate_identifier() {
+        ENTT_ASSERT(reserved.empty());
         // traits_type::entity_mask is reserved to allow for null identifiers
         ENTT_ASSERT(static_cast<typename traits_type::entity_type>(entities.size()) < traits_type::entity_mask);
         return entities.emplace_back(entity_type{static_cast<typename traits_type::entity_type>(entities.size())});
     }
 
     Entity recycle_identifier() {
-        ENTT_ASSERT(available != null);
+        ENTT_ASSERT(available != null && reserved.empty());
         const auto curr = to_integral(available);
         const auto version = to_integral(entities[curr]) & (traits_type::version_mask << traits_type::entity_shift);
         available = entity_type{to_integral(entities[curr]) & traits_type::entity_mask};
@@ -145,6 +238,7 @@ class basic_registry {
     }
 
     void release_entity(const Entity entity, const typename traits_type::version_type version) {
+        ENTT_ASSERT(reserved.empty());
         const auto entt = to_integral(entity) & traits_type::entity_mask;
         entities[entt] = entity_type{to_integral(available) | (typename traits_type::entity_type{version} << traits_type::entity_shift)};
         available = entity_type{entt};
@@ -451,6 +545,91 @@ public:
         }
     }
 
+    /**
+     * @brief Reserves an entity identifier.
+     *
+     * @sa reserve_entities
+     *
+     * @return An entity identifier that becomes valid once committed.
+     */
+    [[nodiscard]] entity_type reserve_entity() {
+        entity_type entt;
+        reserve_entities(&entt, &entt + 1u);
+        return entt;
+    }
+
+    /**
+     * @brief Reserves a block of entity identifiers.
+     *
+     * Identifiers are taken from the list of destroyed entities first, then
+     * new ones are generated. Reserved identifiers aren't valid until they are
+     * committed.<br/>
+     * Reserving identifiers is a lock-free operation. This function can be
+     * invoked concurrently from multiple threads, as long as nothing else is
+     * done with the registry in the meantime.
+     *
+     * @warning
+     * Creating or destroying entities before reserved identifiers have been
+     * committed results in undefined behavior.
+     *
+     * @sa commit_reserved
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range to generate.
+     * @param last An iterator past the last element of the range to generate.
+     */
+    template<typename It>
+    void reserve_entities(It first, It last) {
+        const auto length = static_cast<size_type>(std::distance(first, last));
+        auto head = reserved.head.load(std::memory_order_acquire);
+        typename traits_type::entity_type from;
+        typename traits_type::entity_type next;
+        size_type count;
+
+        // the list of destroyed entities doesn't change while reserving, popping many nodes at once is ABA-free
+        do {
+            from = next = (head == reserved_data::unused) ? to_integral(available) : head;
+
+            for(count = {}; count < length && next != traits_type::entity_mask; ++count) {
+                next = to_integral(entities[next]) & traits_type::entity_mask;
+            }
+        } while(count && !reserved.head.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire));
+
+        for(; count; --count, ++first) {
+            const auto version = to_integral(entities[from]) & (traits_type::version_mask << traits_type::entity_shift);
+            *first = entity_type{from | version};
+            from = to_integral(entities[from]) & traits_type::entity_mask;
+        }
+
+        for(auto pos = entities.size() + reserved.fresh.fetch_add(static_cast<size_type>(std::distance(first, last)), std::memory_order_relaxed); first != last; ++first, ++pos) {
+            // traits_type::entity_mask is reserved to allow for null identifiers
+            ENTT_ASSERT(pos < traits_type::entity_mask);
+            *first = entity_type{static_cast<typename traits_type::entity_type>(pos)};
+        }
+    }
+
+    /**
+     * @brief Makes all the reserved entity identifiers valid.
+     *
+     * This function must be invoked on the thread that owns the registry, once
+     * all the reservations are complete.
+     *
+     * @sa reserve_entities
+     */
+    void commit_reserved() {
+        if(const auto head = reserved.head.exchange(reserved_data::unused, std::memory_order_acq_rel); head != reserved_data::unused) {
+            while(to_integral(available) != head) {
+                const auto curr = to_integral(available);
+                available = entity_type{to_integral(entities[curr]) & traits_type::entity_mask};
+                entities[curr] = entity_type{curr | (to_integral(entities[curr]) & (traits_type::version_mask << traits_type::entity_shift))};
+            }
+        }
+
+        for(auto count = reserved.fresh.exchange(0u, std::memory_order_acq_rel); count; --count) {
+            entities.emplace_back(entity_type{static_cast<typename traits_type::entity_type>(entities.size())});
+        }
+    }
+
     /**
      * @brief Assigns entities to an empty registry.
      *
@@ -471,6 +650,7 @@ public:
     template<typename It>
     void assign(It first, It last, const entity_type destroyed) {
         ENTT_ASSERT(std::all_of(pools.cbegin(), pools.cend(), [](auto &&pdata) { return !pdata.pool || pdata.pool->empty(); }));
+        ENTT_ASSERT(reserved.empty());
         entities.assign(first, last);
         available = destroyed;
     }
@@ -508,16 +688,74 @@ public:
     /**
      * @brief Destroys all the entities in a range.
      *
+     * Pools are visited once and all the entities they contain are removed in
+     * a single pass, then the identifiers are released all at once.<br/>
+     * Each pool that isn't empty is checked against the whole range or the
+     * range is checked against the pool, whichever is smaller. Therefore, the
+     * cost is proportional to the number of pools times the size of the range
+     * at most. The entities of the range that a pool contains are then removed
+     * from it with a single call, even if they're all its entities.
+     * Destroying entities one at a time is cheaper when the range is small and
+     * the registry has many pools.
+     *
      * @sa destroy
      *
+     * @warning
+     * Attempting to destroy the same entity more than once within a range
+     * results in undefined behavior. An assertion will abort the execution at
+     * runtime in debug mode in case of duplicates.
+     *
+     * @warning
+     * In case there are listeners that observe the destruction of components
+     * and assign other components to the entities in their bodies, the result
+     * of invoking this function may not be as expected. In the worst case, it
+     * could lead to undefined behavior.
+     *
      * @tparam It Type of input iterator.
      * @param first An iterator to the first element of the range of entities.
      * @param last An iterator past the last element of the range of entities.
      */
     template<typename It>
     void destroy(It first, It last) {
-        for(; first != last; ++first) {
-            destroy(*first);
+        // the range may refer to a pool that is about to change
+        const std::vector<entity_type> range(first, last);
+        ENTT_ASSERT(std::all_of(range.cbegin(), range.cend(), [this](const auto entity) { return valid(entity); }));
+        // releasing an entity twice would link it twice into the list of available identifiers
+        ENTT_ASSERT([sorted = range]() mutable { std::sort(sorted.begin(), sorted.end()); return std::adjacent_find(sorted.cbegin(), sorted.cend()) == sorted.cend(); }());
+        std::vector<entity_type> owned{};
+        std::vector<bool> doomed{};
+
+        for(auto pos = pools.size(); pos; --pos) {
+            if(auto &pdata = pools[pos-1]; pdata.pool && !pdata.pool->empty()) {
+                owned.clear();
+
+                if(const auto *cpool = pdata.pool.get(); cpool->size() < range.size()) {
+                    if(doomed.empty()) {
+                        // flat table of the entities to destroy, built only once pools are smaller than the range
+                        doomed.resize(entities.size());
+
+                        for(const auto entity: range) {
+                            doomed[size_type(to_integral(entity) & traits_type::entity_mask)] = true;
+                        }
+                    }
+
+                    // tombstones of pools deleted in place are out of the table and are skipped
+                    std::copy_if(cpool->data(), cpool->data() + cpool->size(), std::back_inserter(owned), [&doomed](const auto entity) {
+                        const auto entt = size_type(to_integral(entity) & traits_type::entity_mask);
+                        return entt < doomed.size() && doomed[entt];
+                    });
+                } else {
+                    std::copy_if(range.cbegin(), range.cend(), std::back_inserter(owned), [cpool](const auto entity) { return cpool->contains(entity); });
+                }
+
+                if(!owned.empty()) {
+                    pdata.poly->remove(*this, owned.data(), owned.data() + owned.size());
+                }
+            }
+        }
+
+        for(const auto entity: range) {
+            release_entity(entity, static_cast<version_type>(version(entity) + 1u));
         }
     }
 
@@ -883,6 +1121,116 @@ public:
         }
     }
 
+    /**
+     * @brief Returns the current change tick.
+     *
+     * Components that track changes are stamped with the current change tick
+     * whenever they are assigned, patched or replaced.
+     *
+     * @return The current change tick.
+     */
+    [[nodiscard]] tick_type current_tick() const ENTT_NOEXCEPT {
+        return change_tick;
+    }
+
+    /**
+     * @brief Advances the change tick.
+     *
+     * Ticks are cheap and can be advanced as often as needed, for example once
+     * per frame or after each system. The change tick wraps around once it
+     * reaches its maximum value.
+     *
+     * @param step The number of ticks by which to advance.
+     * @return The new change tick.
+     */
+    tick_type advance_tick(const tick_type step = 1u) ENTT_NOEXCEPT {
+        return (change_tick += step);
+    }
+
+    /**
+     * @brief Returns the tick at which a component was assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an invalid entity or to get a component from an entity
+     * that doesn't own it results in undefined behavior.
+     *
+     * @tparam Component Type of component that tracks changes.
+     * @param entity A valid entity identifier.
+     * @return The tick at which the component was assigned to the entity.
+     */
+    template<typename Component>
+    [[nodiscard]] tick_type added_tick(const entity_type entity) const {
+        static_assert(component_traits<Component>::track_changes, "Component doesn't track changes");
+        const auto *cpool = assure<Component>();
+        ENTT_ASSERT(valid(entity) && cpool && cpool->contains(entity));
+        return cpool->added(entity);
+    }
+
+    /**
+     * @brief Returns the tick at which a component was last changed.
+     *
+     * @warning
+     * Attempting to use an invalid entity or to get a component from an entity
+     * that doesn't own it results in undefined behavior.
+     *
+     * @tparam Component Type of component that tracks changes.
+     * @param entity A valid entity identifier.
+     * @return The tick at which the component was last changed.
+     */
+    template<typename Component>
+    [[nodiscard]] tick_type changed_tick(const entity_type entity) const {
+        static_assert(component_traits<Component>::track_changes, "Component doesn't track changes");
+        const auto *cpool = assure<Component>();
+        ENTT_ASSERT(valid(entity) && cpool && cpool->contains(entity));
+        return cpool->changed(entity);
+    }
+
+    /**
+     * @brief Returns an iterable object to use to visit the entities to which
+     * a component was assigned after a given tick.
+     *
+     * The ticks of the components are scanned linearly, in the order of the
+     * pool, and only the matching entities are returned. Systems that care
+     * about new components don't pay for a lookup per entity this way:
+     *
+     * @code{.cpp}
+     * for(auto entity: registry.added_since<position>(tick)) {
+     *     // ...
+     * }
+     * @endcode
+     *
+     * The iterable object is invalidated as soon as the pool is modified.<br/>
+     * Ticks wrap around. A tick is considered to come after the given one if
+     * it's at most half the range of the tick type ahead of it.
+     *
+     * @tparam Component Type of component that tracks changes.
+     * @param tick The tick after which a component is considered as new.
+     * @return An iterable object to use to visit the matching entities.
+     */
+    template<typename Component>
+    [[nodiscard]] auto added_since(const tick_type tick) const {
+        static_assert(component_traits<Component>::track_changes, "Component doesn't track changes");
+        const auto *cpool = assure<Component>();
+        return cpool ? cpool->added_since(tick) : decltype(cpool->added_since(tick)){};
+    }
+
+    /**
+     * @brief Returns an iterable object to use to visit the entities whose
+     * component changed after a given tick.
+     *
+     * @sa added_since
+     *
+     * @tparam Component Type of component that tracks changes.
+     * @param tick The tick after which a component is considered as changed.
+     * @return An iterable object to use to visit the matching entities.
+     */
+    template<typename Component>
+    [[nodiscard]] auto changed_since(const tick_type tick) const {
+        static_assert(component_traits<Component>::track_changes, "Component doesn't track changes");
+        const auto *cpool = assure<Component>();
+        return cpool ? cpool->changed_since(tick) : decltype(cpool->changed_since(tick)){};
+    }
+
     /**
      * @brief Clears a whole registry or the pools for the given components.
      * @tparam Component Types of components to remove from their entities.
@@ -892,6 +1240,7 @@ public:
         if constexpr(sizeof...(Component) == 0) {
             for(auto pos = pools.size(); pos; --pos) {
                 if(auto &pdata = pools[pos-1]; pdata.pool) {
+                    pdata.pool->compact();
                     pdata.poly->remove(*this, pdata.pool->rbegin(), pdata.pool->rend());
                 }
             }
@@ -903,11 +1252,90 @@ public:
             }
         } else {
             ([this](auto *cpool) {
+                cpool->compact();
                 cpool->remove(*this, cpool->basic_sparse_set<entity_type>::begin(), cpool->basic_sparse_set<entity_type>::end());
             }(assure<Component>()), ...);
         }
     }
 
+    /**
+     * @brief Clones a registry.
+     *
+     * A clone contains the same entities, with the same identifiers, and a copy
+     * of all the pools. Pools are copied as a whole without knowing their
+     * types. Sparse and packed arrays are copied in bulk, so are
+     * the pages of trivially copyable components. Other components are copied
+     * one at a time.<br/>
+     * Change ticks are preserved. Signals, groups and context variables aren't
+     * part of a clone.
+     *
+     * @warning
+     * All the components must be copy constructible. An assertion will abort
+     * the execution at runtime in debug mode otherwise.
+     *
+     * @return A copy of the registry.
+     */
+    [[nodiscard]] basic_registry clone() const {
+        ENTT_ASSERT(reserved.empty());
+        basic_registry other{};
+        other.pools.resize(pools.size());
+
+        for(size_type pos{}, last = pools.size(); pos < last; ++pos) {
+            clone_pool(pos, other);
+        }
+
+        other.entities = entities;
+        other.available = available;
+        other.change_tick = change_tick;
+
+        return other;
+    }
+
+    /**
+     * @brief Replaces the content of a registry with a copy of another one.
+     *
+     * Entities, identifiers and pools are copied as they are copied by
+     * `clone`, change ticks included. Unlike `clone`, the memory already
+     * allocated by the registry is reused, so that assigning states of similar
+     * size over and over doesn't hit the allocator.<br/>
+     * Pools that don't exist in the other registry are emptied and keep their
+     * memory, unless their components aren't copyable. Listeners and
+     * context variables are left untouched and no signals are emitted.
+     *
+     * @warning
+     * Groups wouldn't be updated, therefore the registry mustn't have any.
+     * All the components of the other registry must be copy constructible. An
+     * assertion will abort the execution at runtime in debug mode otherwise.
+     *
+     * @param other The registry to copy from.
+     */
+    void assign(const basic_registry &other) {
+        ENTT_ASSERT(groups.empty());
+        ENTT_ASSERT(reserved.empty() && other.reserved.empty());
+
+        if(this != &other) {
+            if(pools.size() < other.pools.size()) {
+                pools.resize(other.pools.size());
+            }
+
+            for(size_type pos{}, last = pools.size(); pos < last; ++pos) {
+                if(pos < other.pools.size() && other.pools[pos].pool) {
+                    other.clone_pool(pos, *this);
+                } else if(auto &&pdata = pools[pos]; pdata.clone) {
+                    // copying an empty pool keeps its pages, clearing it would release them
+                    pdata.clone(nullptr, pdata);
+                } else if(pdata.pool) {
+                    // the sparse set is emptied directly, the mixins and their signals are bypassed
+                    pdata.pool->basic_sparse_set<entity_type>::clear();
+                }
+            }
+
+            entities = other.entities;
+            available = other.available;
+            change_tick = other.change_tick;
+        }
+    }
+
     /**
      * @brief Iterates all the entities that are still in use.
      *
@@ -1000,6 +1428,32 @@ public:
         return assure<Component>()->on_construct();
     }
 
+    /**
+     * @brief Returns a sink object for the given component.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever instances of the given component are created and assigned to a
+     * range of entities.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<Entity> &, const Entity *, const Entity *);
+     * @endcode
+     *
+     * Listeners receive a contiguous span of entities once per operation.
+     * They are invoked **after** the components have been assigned and
+     * **before** the listeners returned by `on_construct`.
+     *
+     * @sa sink
+     *
+     * @tparam Component Type of component of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Component>
+    [[nodiscard]] auto on_construct_range() {
+        return assure<Component>()->on_construct_range();
+    }
+
     /**
      * @brief Returns a sink object for the given component.
      *
@@ -1048,6 +1502,32 @@ public:
         return assure<Component>()->on_destroy();
     }
 
+    /**
+     * @brief Returns a sink object for the given component.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever instances of the given component are removed from a range of
+     * entities and thus destroyed.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<Entity> &, const Entity *, const Entity *);
+     * @endcode
+     *
+     * Listeners receive a contiguous span of entities once per operation.
+     * They are invoked **before** the components have been removed and
+     * **before** the listeners returned by `on_destroy`.
+     *
+     * @sa sink
+     *
+     * @tparam Component Type of component of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Component>
+    [[nodiscard]] auto on_destroy_range() {
+        return assure<Component>()->on_destroy_range();
+    }
+
     /**
      * @brief Returns a view for the given components.
      *
@@ -1171,6 +1651,7 @@ public:
     [[nodiscard]] basic_group<Entity, exclude_t<Exclude...>, get_t<Get...>, Owned...> group(get_t<Get...>, exclude_t<Exclude...> = {}) {
         static_assert(sizeof...(Owned) + sizeof...(Get) > 0, "Exclusion-only groups are not supported");
         static_assert(sizeof...(Owned) + sizeof...(Get) + sizeof...(Exclude) > 1, "Single component groups are not allowed");
+        static_assert(!(component_traits<std::remove_const_t<Owned>>::in_place_delete || ...), "Types deleted in place cannot be owned by a group");
 
         using handler_type = group_handler<exclude_t<Exclude...>, get_t<std::decay_t<Get>...>, std::decay_t<Owned>...>;
 
@@ -1224,13 +1705,13 @@ public:
                 groups.insert(next, std::move(candidate));
             }
 
-            (on_construct<std::decay_t<Owned>>().before(maybe_valid_if).template connect<&handler_type::template maybe_valid_if<std::decay_t<Owned>>>(*handler), ...);
-            (on_construct<std::decay_t<Get>>().before(maybe_valid_if).template connect<&handler_type::template maybe_valid_if<std::decay_t<Get>>>(*handler), ...);
-            (on_destroy<Exclude>().before(maybe_valid_if).template connect<&handler_type::template maybe_valid_if<Exclude>>(*handler), ...);
+            (on_construct_range<std::decay_t<Owned>>().before(maybe_valid_if).template connect<&handler_type::template maybe_valid_if<std::decay_t<Owned>>>(*handler), ...);
+            (on_construct_range<std::decay_t<Get>>().before(maybe_valid_if).template connect<&handler_type::template maybe_valid_if<std::decay_t<Get>>>(*handler), ...);
+            (on_destroy_range<Exclude>().before(maybe_valid_if).template connect<&handler_type::template maybe_valid_if<Exclude>>(*handler), ...);
 
-            (on_destroy<std::decay_t<Owned>>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
-            (on_destroy<std::decay_t<Get>>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
-            (on_construct<Exclude>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
+            (on_destroy_range<std::decay_t<Owned>>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
+            (on_destroy_range<std::decay_t<Get>>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
+            (on_construct_range<Exclude>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
 
             if constexpr(sizeof...(Owned) == 0) {
                 for(const auto entity: view<Owned..., Get...>(exclude<Exclude...>)) {
@@ -1238,9 +1719,8 @@ public:
                 }
             } else {
                 // we cannot iterate backwards because we want to leave behind valid entities in case of owned types
-                for(auto *first = std::get<0>(cpools)->data(), *last = first + std::get<0>(cpools)->size(); first != last; ++first) {
-                    handler->template maybe_valid_if<type_list_element_t<0, type_list<std::decay_t<Owned>...>>>(*this, *first);
-                }
+                const auto *first = std::get<0>(cpools)->data();
+                handler->template maybe_valid_if<type_list_element_t<0, type_list<std::decay_t<Owned>...>>>(*this, first, first + std::get<0>(cpools)->size());
             }
         }
 
@@ -1314,6 +1794,24 @@ public:
         return std::none_of(groups.cbegin(), groups.cend(), [](auto &&gdata) { return (gdata.owned(type_hash<std::decay_t<Component>>::value()) || ...); });
     }
 
+    /**
+     * @brief Checks whether the given components can be assigned concurrently.
+     *
+     * Groups listen to the pools of the components they own, observe or
+     * exclude and access all of them when any one changes. Components that
+     * share a group cannot be assigned or removed concurrently.
+     *
+     * @tparam Component Types of components in which one is interested.
+     * @return True if no group refers to more than one of the given components,
+     * false otherwise.
+     */
+    template<typename... Component>
+    [[nodiscard]] bool independent() const {
+        return std::none_of(groups.cbegin(), groups.cend(), [](auto &&gdata) {
+            return (0u + ... + (gdata.owned(type_hash<std::decay_t<Component>>::value()) || gdata.get(type_hash<std::decay_t<Component>>::value()) || gdata.exclude(type_hash<std::decay_t<Component>>::value()))) > 1u;
+        });
+    }
+
     /**
      * @brief Checks whether a group can be sorted.
      * @tparam Owned Types of components owned by the group.
@@ -1363,6 +1861,10 @@ public:
      * necessarily the type of the one passed along with the other parameters to
      * this member function.
      *
+     * @note
+     * Pools of components deleted in place are compacted before they're
+     * sorted. References to their components are invalidated afterwards.
+     *
      * @warning
      * Pools of components owned by a group cannot be sorted.
      *
@@ -1377,7 +1879,9 @@ public:
     template<typename Component, typename Compare, typename Sort = std_sort, typename... Args>
     void sort(Compare compare, Sort algo = Sort{}, Args &&... args) {
         ENTT_ASSERT(sortable<Component>());
-        assure<Component>()->sort(std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        auto *cpool = assure<Component>();
+        cpool->compact();
+        cpool->sort(std::move(compare), std::move(algo), std::forward<Args>(args)...);
     }
 
     /**
@@ -1407,6 +1911,10 @@ public:
      *
      * Any subsequent change to `B` won't affect the order in `A`.
      *
+     * @note
+     * Pools of components deleted in place are compacted before they're
+     * sorted. References to their components are invalidated afterwards.
+     *
      * @warning
      * Pools of components owned by a group cannot be sorted.
      *
@@ -1416,7 +1924,9 @@ public:
     template<typename To, typename From>
     void sort() {
         ENTT_ASSERT(sortable<To>());
-        assure<To>()->respect(*assure<From>());
+        auto *cpool = assure<To>();
+        cpool->compact();
+        cpool->respect(*assure<From>());
     }
 
     /**
@@ -1491,9 +2001,31 @@ public:
      */
     template<typename Type, typename... Args>
     Type & set(Args &&... args) {
+        const auto index = type_seq<Type>::value();
+        const auto page = size_type{index} / variable_page;
         unset<Type>();
-        vars.push_back(variable_data{type_id<Type>(), { new Type{std::forward<Args>(args)...}, [](void *instance) { delete static_cast<Type *>(instance); } }});
-        return *static_cast<Type *>(vars.back().value.get());
+
+        if(!(page < vars.size())) {
+            vars.resize(page + 1u);
+        }
+
+        if(!vars[page]) {
+            vars[page] = std::make_unique<variable_data[]>(variable_page);
+        }
+
+        auto &var = vars[page][size_type{index} % variable_page];
+
+        // small types are stored in place, pages never move them around
+        if constexpr(sizeof(Type) <= sizeof(var.storage) && alignof(Type) <= alignof(decltype(var.storage))) {
+            var.instance = new (&var.storage) Type{std::forward<Args>(args)...};
+            var.destroy = [](void *instance) { static_cast<Type *>(instance)->~Type(); };
+        } else {
+            var.instance = new Type{std::forward<Args>(args)...};
+            var.destroy = [](void *instance) { delete static_cast<Type *>(instance); };
+        }
+
+        var.info = type_id<Type>();
+        return *static_cast<Type *>(var.instance);
     }
 
     /**
@@ -1502,9 +2034,9 @@ public:
      */
     template<typename Type>
     void unset() {
-        vars.erase(std::remove_if(vars.begin(), vars.end(), [](auto &&var) {
-            return var.info.hash() == type_hash<Type>::value();
-        }), vars.end());
+        if(auto *var = const_cast<variable_data *>(variable(type_seq<Type>::value())); var) {
+            var->reset();
+        }
     }
 
     /**
@@ -1532,8 +2064,8 @@ public:
      */
     template<typename Type>
     [[nodiscard]] const Type * try_ctx() const {
-        auto it = std::find_if(vars.cbegin(), vars.cend(), [](auto &&var) { return var.info.hash() == type_hash<Type>::value(); });
-        return it == vars.cend() ? nullptr : static_cast<const Type *>(it->value.get());
+        const auto *var = variable(type_seq<Type>::value());
+        return var ? static_cast<const Type *>(var->instance) : nullptr;
     }
 
     /*! @copydoc try_ctx */
@@ -1588,8 +2120,12 @@ public:
      */
     template<typename Func>
     void ctx(Func func) const {
-        for(auto pos = vars.size(); pos; --pos) {
-            func(vars[pos-1].info);
+        for(auto page = vars.size(); page; --page) {
+            for(auto pos = variable_page; vars[page-1] && pos; --pos) {
+                if(const auto &var = vars[page-1][pos-1]; var.instance) {
+                    func(var.info);
+                }
+            }
         }
     }
 
@@ -1597,8 +2133,10 @@ private:
     std::vector<pool_data> pools{};
     std::vector<group_data> groups{};
     std::vector<entity_type> entities{};
-    std::vector<variable_data> vars{};
+    std::vector<std::unique_ptr<variable_data[]>> vars{};
     entity_type available{null};
+    reserved_data reserved{};
+    tick_type change_tick{};
 };
 
 
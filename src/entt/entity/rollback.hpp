@@ -0,0 +1,171 @@
+#ifndef ENTT_ENTITY_ROLLBACK_HPP
+#define ENTT_ENTITY_ROLLBACK_HPP
+
+
+#include <cstddef>
+#include <vector>
+#include "../config/config.h"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Rollback buffer.
+ *
+ * A rollback buffer keeps the states of a registry for a bounded number of
+ * frames in a ring. Frame `N` is stored in slot `N % length` and replaces the
+ * oldest state that was stored there, if any.<br/>
+ * States are whole copies of the registry taken as described for
+ * `basic_registry::assign`. Slots are registries themselves and are reused from
+ * frame to frame, therefore capturing and restoring states of similar size
+ * doesn't allocate once the ring is warm.
+ *
+ * Restoring a frame replaces the content of the registry in place. Listeners
+ * and context variables are left untouched and no signals are emitted. The
+ * states of the frames that follow the restored one are discarded, since they
+ * are about to be simulated again.
+ *
+ * @warning
+ * The registry mustn't have any group and all its components must be copy
+ * constructible. An assertion will abort the execution at runtime in debug mode
+ * otherwise.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_rollback final {
+    struct frame_data {
+        basic_registry<Entity> state{};
+        std::size_t frame{};
+        bool valid{};
+    };
+
+    [[nodiscard]] const frame_data & slot(const std::size_t frame) const {
+        return frames[frame % frames.size()];
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a rollback buffer for a given registry.
+     * @param ref A valid reference to a registry.
+     * @param length Maximum number of frames to keep, greater than zero.
+     */
+    basic_rollback(basic_registry<entity_type> &ref, const size_type length)
+        : reg{&ref},
+          frames(length)
+    {
+        ENTT_ASSERT(length);
+    }
+
+    /*! @brief Default move constructor. */
+    basic_rollback(basic_rollback &&) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This rollback buffer.
+     */
+    basic_rollback & operator=(basic_rollback &&) = default;
+
+    /**
+     * @brief Returns the maximum number of frames kept by a rollback buffer.
+     * @return Maximum number of frames kept.
+     */
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
+        return frames.size();
+    }
+
+    /**
+     * @brief Checks if the state of a given frame is available.
+     * @param frame A frame number.
+     * @return True if the state of the frame is available, false otherwise.
+     */
+    [[nodiscard]] bool contains(const size_type frame) const {
+        const auto &fdata = slot(frame);
+        return fdata.valid && fdata.frame == frame;
+    }
+
+    /**
+     * @brief Returns the state captured for a given frame.
+     *
+     * @warning
+     * Attempting to use a frame that isn't available results in undefined
+     * behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * frame isn't available.
+     *
+     * @param frame A valid frame number.
+     * @return A copy of the registry as it was at the given frame.
+     */
+    [[nodiscard]] const basic_registry<entity_type> & state(const size_type frame) const {
+        ENTT_ASSERT(contains(frame));
+        return slot(frame).state;
+    }
+
+    /**
+     * @brief Captures the current state of the registry for a given frame.
+     *
+     * The state previously stored in the same slot is overwritten, whatever
+     * its frame.
+     *
+     * @param frame A frame number.
+     */
+    void capture(const size_type frame) {
+        auto &fdata = frames[frame % frames.size()];
+        fdata.state.assign(*reg);
+        fdata.frame = frame;
+        fdata.valid = true;
+    }
+
+    /**
+     * @brief Restores the state of the registry at a given frame.
+     *
+     * The states of the frames that follow the given one are discarded, the
+     * state of the frame itself is kept.
+     *
+     * @warning
+     * Attempting to use a frame that isn't available results in undefined
+     * behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * frame isn't available.
+     *
+     * @param frame A valid frame number.
+     */
+    void restore(const size_type frame) {
+        ENTT_ASSERT(contains(frame));
+        reg->assign(slot(frame).state);
+
+        for(auto &&fdata: frames) {
+            fdata.valid = fdata.valid && !(frame < fdata.frame);
+        }
+    }
+
+    /**
+     * @brief Discards all the states captured so far.
+     *
+     * Memory isn't released, it's reused by the following captures.
+     */
+    void clear() ENTT_NOEXCEPT {
+        for(auto &&fdata: frames) {
+            fdata.valid = false;
+        }
+    }
+
+private:
+    basic_registry<entity_type> *reg;
+    std::vector<frame_data> frames;
+};
+
+
+}
+
+
+#endif
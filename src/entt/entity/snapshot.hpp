@@ -2,18 +2,25 @@
 #define ENTT_ENTITY_SNAPSHOT_HPP
 
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <memory>
 #include <tuple>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
+#include "component.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
+#include "helper.hpp"
 #include "registry.hpp"
 
 
@@ -119,7 +126,7 @@ public:
     const basic_snapshot & component(Archive &archive) const {
         if constexpr(sizeof...(Component) == 1u) {
             const auto view = reg->template view<const Component...>();
-            (component<Component>(archive, view.data(), view.data() + view.size()), ...);
+            (component<Component>(archive, view.rbegin(), view.rend()), ...);
             return *this;
         } else {
             (component<Component>(archive), ...);
@@ -294,6 +301,10 @@ private:
  * Identifiers that entities originally had are not transferred to the target.
  * Instead, the loader maps remote identifiers to local ones while restoring a
  * snapshot.<br/>
+ * Remote identifiers are mapped through a paged table indexed by their entity
+ * part, one version at a time. A live remote entity replaces any other version
+ * of the same identifier, while a destroyed one only replaces versions that
+ * have no live local counterpart.<br/>
  * An example of use is the implementation of a client-server applications with
  * the requirement of transferring somehow parts of the representation side to
  * side.
@@ -302,30 +313,109 @@ private:
  */
 template<typename Entity>
 class basic_continuous_loader {
+    // same page geometry as sparse sets, but slots hold the mapping in place rather than a position in a packed array
+    static constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(Entity);
+    // components are restored in batches, one page of the table at most
+    static constexpr std::size_t batch_size = entt_per_page;
+
     using traits_type = entt_traits<Entity>;
 
+    struct remote_data {
+        Entity remote;
+        Entity local;
+        bool dirty;
+    };
+
+    using page_type = std::unique_ptr<remote_data[]>;
+
+    [[nodiscard]] static bool vacant(const remote_data &elem) ENTT_NOEXCEPT {
+        // identifiers with a null entity part and a non-null version are valid keys
+        return to_integral(elem.remote) == to_integral(entity_type{null});
+    }
+
+    [[nodiscard]] auto page(const Entity entt) const ENTT_NOEXCEPT {
+        return std::size_t{(to_integral(entt) & traits_type::entity_mask) / entt_per_page};
+    }
+
+    [[nodiscard]] auto offset(const Entity entt) const ENTT_NOEXCEPT {
+        return std::size_t{to_integral(entt) & (entt_per_page - 1)};
+    }
+
+    [[nodiscard]] const remote_data * lookup(const Entity entt) const ENTT_NOEXCEPT {
+        const auto pos = page(entt);
+        return (pos < remloc.size() && remloc[pos] && remloc[pos][offset(entt)].remote == entt) ? &remloc[pos][offset(entt)] : nullptr;
+    }
+
+    [[nodiscard]] remote_data & assure(const Entity entt) {
+        const auto pos = page(entt);
+
+        if(!(pos < remloc.size())) {
+            remloc.resize(pos+1);
+        }
+
+        if(!remloc[pos]) {
+            remloc[pos].reset(new remote_data[entt_per_page]);
+
+            for(auto *first = remloc[pos].get(), *last = first + entt_per_page; first != last; ++first) {
+                *first = remote_data{null, null, false};
+            }
+        }
+
+        return remloc[pos][offset(entt)];
+    }
+
+    template<typename Func>
+    void each(Func func) {
+        for(auto &&curr: remloc) {
+            if(curr) {
+                for(auto *first = curr.get(), *last = first + entt_per_page; first != last; ++first) {
+                    if(!vacant(*first)) {
+                        func(*first);
+                    }
+                }
+            }
+        }
+    }
+
+    void release(remote_data &elem) {
+        if(reg->valid(elem.local)) {
+            reg->destroy(elem.local);
+        }
+
+        elem = remote_data{null, null, false};
+    }
+
     void destroy(Entity entt) {
-        if(const auto it = remloc.find(entt); it == remloc.cend()) {
+        // slots are shared by all the versions of a remote identifier, destroyed ones never replace live ones
+        if(auto &elem = assure(entt); vacant(elem) || (elem.remote != entt && !reg->valid(elem.local))) {
             const auto local = reg->create();
-            remloc.emplace(entt, std::make_pair(local, true));
+            elem = remote_data{entt, local, true};
             reg->destroy(local);
         }
     }
 
-    void restore(Entity entt) {
-        const auto it = remloc.find(entt);
+    remote_data & prepare(Entity entt) {
+        auto &elem = assure(entt);
 
-        if(it == remloc.cend()) {
-            const auto local = reg->create();
-            remloc.emplace(entt, std::make_pair(local, true));
-        } else {
-            if(!reg->valid(remloc[entt].first)) {
-                remloc[entt].first = reg->create();
-            }
+        if(elem.remote != entt) {
+            // the remote identifier was recycled, its local counterpart is stale
+            release(elem);
+            elem.remote = entt;
+        }
+
+        // set the dirty flag
+        elem.dirty = true;
+        return elem;
+    }
+
+    Entity restore(Entity entt) {
+        auto &elem = prepare(entt);
 
-            // set the dirty flag
-            remloc[entt].second = true;
+        if(!reg->valid(elem.local)) {
+            elem.local = reg->create();
         }
+
+        return elem.local;
     }
 
     template<typename Container>
@@ -376,10 +466,40 @@ class basic_continuous_loader {
 
     template<typename Component>
     void remove_if_exists() {
-        for(auto &&ref: remloc) {
-            const auto local = ref.second.first;
+        each([this](auto &elem) {
+            if(reg->valid(elem.local)) {
+                reg->template remove_if_exists<Component>(elem.local);
+            }
+        });
+    }
+
+    template<typename Archive>
+    void discard(Archive &archive) {
+        typename traits_type::entity_type length{};
+        entity_type entt{};
+
+        archive(length);
+
+        while(length--) {
+            archive(entt);
 
-            if(reg->valid(local)) {
+            if(lookup(entt)) {
+                release(assure(entt));
+            }
+        }
+    }
+
+    template<typename Component, typename Archive>
+    void discard(Archive &archive) {
+        typename traits_type::entity_type length{};
+        entity_type entt{};
+
+        archive(length);
+
+        while(length--) {
+            archive(entt);
+
+            if(const auto local = map(entt); local != null && reg->valid(local)) {
                 reg->template remove_if_exists<Component>(local);
             }
         }
@@ -395,8 +515,7 @@ class basic_continuous_loader {
         if constexpr(std::tuple_size_v<decltype(reg->template view<Other>().get({}))> == 0) {
             while(length--) {
                 archive(entt);
-                restore(entt);
-                reg->template emplace_or_replace<Other>(map(entt));
+                reg->template emplace_or_replace<Other>(restore(entt));
             }
         } else {
             Other instance{};
@@ -404,8 +523,44 @@ class basic_continuous_loader {
             while(length--) {
                 archive(entt, instance);
                 (update(instance, member), ...);
-                restore(entt);
-                reg->template emplace_or_replace<Other>(map(entt), std::move(instance));
+                reg->template emplace_or_replace<Other>(restore(entt), std::move(instance));
+            }
+        }
+    }
+
+    template<typename Other, typename Archive, typename... Type, typename... Member>
+    void insert(Archive &archive, [[maybe_unused]] Member Type:: *... member) {
+        typename traits_type::entity_type length{};
+        archive(length);
+
+        std::vector<entity_type> local{};
+        local.reserve((std::min)(std::size_t{length}, batch_size));
+        entity_type entt{};
+
+        if constexpr(std::tuple_size_v<decltype(reg->template view<Other>().get({}))> == 0) {
+            while(length) {
+                for(auto count = (std::min)(std::size_t{length}, batch_size); count; --count, --length) {
+                    archive(entt);
+                    local.push_back(restore(entt));
+                }
+
+                reg->template insert<Other>(local.cbegin(), local.cend());
+                local.clear();
+            }
+        } else {
+            std::vector<Other> instance{};
+            instance.reserve(local.capacity());
+
+            while(length) {
+                for(auto count = (std::min)(std::size_t{length}, batch_size); count; --count, --length) {
+                    archive(entt, instance.emplace_back());
+                    (update(instance.back(), member), ...);
+                    local.push_back(restore(entt));
+                }
+
+                reg->template insert<Other>(local.cbegin(), local.cend(), std::make_move_iterator(instance.begin()), std::make_move_iterator(instance.end()));
+                instance.clear();
+                local.clear();
             }
         }
     }
@@ -445,16 +600,29 @@ public:
 
         archive(length);
 
+        std::vector<remote_data *> pending{};
+        remloc.reserve((std::size_t{length} + entt_per_page - 1u) / entt_per_page);
+
         for(decltype(length) pos{}; pos < length; ++pos) {
             archive(entt);
 
             if(const auto entity = (to_integral(entt) & traits_type::entity_mask); entity == pos) {
-                restore(entt);
+                if(auto &elem = prepare(entt); !reg->valid(elem.local)) {
+                    pending.push_back(&elem);
+                }
             } else {
                 destroy(entt);
             }
         }
 
+        // local counterparts are created all at once for new remote entities
+        std::vector<entity_type> local(pending.size());
+        reg->create(local.begin(), local.end());
+
+        for(std::size_t pos{}, last = pending.size(); pos < last; ++pos) {
+            pending[pos]->local = local[pos];
+        }
+
         // discards the head of the list of destroyed entities
         archive(entt);
 
@@ -483,36 +651,82 @@ public:
     template<typename... Component, typename Archive, typename... Type, typename... Member>
     basic_continuous_loader & component(Archive &archive, Member Type:: *... member) {
         (remove_if_exists<Component>(), ...);
-        (assign<Component>(archive, member...), ...);
+        (insert<Component>(archive, member...), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Applies the changes to the entities from a delta snapshot.
+     *
+     * Local counterparts of destroyed entities are destroyed in turn, while
+     * local counterparts are created for new entities.
+     *
+     * @sa basic_delta_snapshot
+     *
+     * @tparam Archive Type of input archive.
+     * @param archive A valid reference to an input archive.
+     * @return A non-const reference to this loader.
+     */
+    template<typename Archive>
+    basic_continuous_loader & entities_delta(Archive &archive) {
+        typename traits_type::entity_type length{};
+        entity_type entt{};
+
+        discard(archive);
+        archive(length);
+
+        while(length--) {
+            archive(entt);
+            restore(entt);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Applies the changes to the given components from a delta
+     * snapshot.
+     *
+     * Unlike a full restore, components that aren't part of the delta are left
+     * untouched. Members are updated the same way they are for full snapshots.
+     *
+     * @sa basic_delta_snapshot
+     * @sa component
+     *
+     * @tparam Component Type of component to restore.
+     * @tparam Archive Type of input archive.
+     * @tparam Type Types of components to update with local counterparts.
+     * @tparam Member Types of members to update with their local counterparts.
+     * @param archive A valid reference to an input archive.
+     * @param member Members to update with their local counterparts.
+     * @return A non-const reference to this loader.
+     */
+    template<typename... Component, typename Archive, typename... Type, typename... Member>
+    basic_continuous_loader & component_delta(Archive &archive, Member Type:: *... member) {
+        ((discard<Component>(archive), assign<Component>(archive, member...)), ...);
         return *this;
     }
 
     /**
      * @brief Helps to purge entities that no longer have a conterpart.
      *
+     * @warning
+     * Entities that didn't change aren't part of a delta snapshot. Therefore,
+     * this function isn't meant to be used after applying deltas.
+     *
      * Users should invoke this member function after restoring each snapshot,
      * unless they know exactly what they are doing.
      *
      * @return A non-const reference to this loader.
      */
     basic_continuous_loader & shrink() {
-        auto it = remloc.begin();
-
-        while(it != remloc.cend()) {
-            const auto local = it->second.first;
-            bool &dirty = it->second.second;
-
-            if(dirty) {
-                dirty = false;
-                ++it;
+        each([this](auto &elem) {
+            if(elem.dirty) {
+                elem.dirty = false;
             } else {
-                if(reg->valid(local)) {
-                    reg->destroy(local);
-                }
-
-                it = remloc.erase(it);
+                release(elem);
             }
-        }
+        });
 
         return *this;
     }
@@ -541,7 +755,7 @@ public:
      * @return True if `entity` is managed by the loader, false otherwise.
      */
     [[nodiscard]] bool contains(entity_type entt) const ENTT_NOEXCEPT {
-        return (remloc.find(entt) != remloc.cend());
+        return (lookup(entt) != nullptr);
     }
 
     /**
@@ -550,22 +764,887 @@ public:
      * @return The local identifier if any, the null entity otherwise.
      */
     [[nodiscard]] entity_type map(entity_type entt) const ENTT_NOEXCEPT {
-        const auto it = remloc.find(entt);
-        entity_type other = null;
+        const auto *elem = lookup(entt);
+        return elem ? elem->local : entity_type{null};
+    }
+
+private:
+    std::vector<page_type> remloc;
+    basic_registry<entity_type> *reg;
+};
+
+
+/**
+ * @brief Utility class to create incremental snapshots from a registry.
+ *
+ * A _delta snapshot_ only contains what changed since the previous delta taken
+ * with the same instance: created and destroyed entities, removed components
+ * and components that were either assigned or updated in the meantime.<br/>
+ * The first delta is always a full dump, since the baseline is an empty
+ * registry. Deltas are meant to be restored in the same order in which they
+ * were created by means of a continuous loader.
+ *
+ * Updates are detected through change ticks, therefore only components that
+ * track changes produce compact deltas. All the instances of the other types
+ * are part of each delta.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_delta_snapshot {
+    using traits_type = entt_traits<Entity>;
+
+    struct component_data {
+        std::vector<Entity> entities{};
+        tick_type tick{};
+    };
+
+    [[nodiscard]] static bool alive(const Entity entt, const std::size_t pos) ENTT_NOEXCEPT {
+        return (entt != null) && (static_cast<std::size_t>(to_integral(entt) & traits_type::entity_mask) == pos);
+    }
+
+    template<typename Archive>
+    static void put(Archive &archive, const std::vector<Entity> &entities) {
+        archive(typename traits_type::entity_type(entities.size()));
+
+        for(auto entt: entities) {
+            archive(entt);
+        }
+    }
+
+    template<typename Component, typename Archive>
+    void delta(Archive &archive) {
+        const auto index = type_seq<Component>::value();
+
+        if(!(index < pools.size())) {
+            pools.resize(index+1u);
+        }
+
+        auto &&cdata = pools[index];
+        const auto view = reg->template view<std::add_const_t<Component>>();
+        std::vector<entity_type> removed{};
+
+        for(auto entt: cdata.entities) {
+            if(!reg->valid(entt) || !reg->template has<Component>(entt)) {
+                removed.push_back(entt);
+            }
+        }
+
+        put(archive, removed);
+        cdata.entities.assign(view.begin(), view.end());
+
+        if constexpr(component_traits<Component>::track_changes) {
+            const auto tick = std::exchange(cdata.tick, reg->current_tick());
+            // components changed during the tick of the previous delta are sent again
+            const auto changed = reg->template changed_since<Component>(static_cast<tick_type>(tick - 1u));
+            const auto sz = std::distance(changed.begin(), changed.end());
+            archive(typename traits_type::entity_type(sz));
+
+            for(auto entt: changed) {
+                std::apply(archive, std::tuple_cat(std::make_tuple(entt), view.get(entt)));
+            }
+        } else {
+            archive(typename traits_type::entity_type(cdata.entities.size()));
+
+            for(auto entt: view) {
+                std::apply(archive, std::tuple_cat(std::make_tuple(entt), view.get(entt)));
+            }
+        }
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+
+    /**
+     * @brief Constructs an instance that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_delta_snapshot(const basic_registry<entity_type> &source) ENTT_NOEXCEPT
+        : reg{&source},
+          baseline{},
+          pools{}
+    {}
+
+    /*! @brief Default move constructor. */
+    basic_delta_snapshot(basic_delta_snapshot &&) = default;
+
+    /*! @brief Default move assignment operator. @return This snapshot. */
+    basic_delta_snapshot & operator=(basic_delta_snapshot &&) = default;
+
+    /**
+     * @brief Puts aside the entities created and destroyed since the previous
+     * delta.
+     *
+     * Entities are serialized along with their versions. Those that were
+     * destroyed and then recreated in the meantime are part of both the lists.
+     *
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename Archive>
+    basic_delta_snapshot & entities(Archive &archive) {
+        const auto sz = reg->size();
+        const auto *data = reg->data();
+        std::vector<entity_type> created{};
+        std::vector<entity_type> destroyed{};
+
+        for(std::size_t pos{}, last = (std::max)(sz, baseline.size()); pos < last; ++pos) {
+            const entity_type curr = (pos < sz) ? data[pos] : entity_type{null};
+            const entity_type prev = (pos < baseline.size()) ? baseline[pos] : entity_type{null};
 
-        if(it != remloc.cend()) {
-            other = it->second.first;
+            if(curr != prev) {
+                if(alive(prev, pos)) {
+                    destroyed.push_back(prev);
+                }
+
+                if(alive(curr, pos)) {
+                    created.push_back(curr);
+                }
+            }
         }
 
-        return other;
+        put(archive, destroyed);
+        put(archive, created);
+        baseline.assign(data, data + sz);
+
+        return *this;
+    }
+
+    /**
+     * @brief Puts aside the changes to the given components since the previous
+     * delta.
+     *
+     * For each type, removed components are serialized first by means of the
+     * entities to which they belonged. Then each instance assigned or updated
+     * since the previous delta is serialized together with its entity.<br/>
+     * Changes are detected by comparing change ticks with the current tick at
+     * the time of the previous delta. Instances updated during that very tick
+     * are conservatively serialized again. Advancing the tick after taking a
+     * delta keeps the next one as small as possible.
+     *
+     * @tparam Component Types of components to serialize.
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename... Component, typename Archive>
+    basic_delta_snapshot & component(Archive &archive) {
+        (delta<Component>(archive), ...);
+        return *this;
     }
 
 private:
-    std::unordered_map<entity_type, std::pair<entity_type, bool>> remloc;
-    basic_registry<entity_type> *reg;
+    const basic_registry<entity_type> *reg;
+    std::vector<entity_type> baseline;
+    std::vector<component_data> pools;
 };
 
 
+/*! @brief Header of the blocks of a binary snapshot. */
+struct binary_snapshot_header {
+    /*! @brief Version of the binary format. */
+    std::uint32_t version;
+    /*! @brief Size of the elements in bytes, zero if only entities are stored. */
+    std::uint32_t size_of;
+    /*! @brief Alignment of the elements in bytes. */
+    std::uint32_t align_of;
+    /*! @brief Reserved for future use, always zero. */
+    std::uint32_t reserved;
+    /*! @brief Hash of the type of the elements, whatever the size of an identifier. */
+    std::uint64_t hash;
+    /*! @brief Number of elements in the block. */
+    std::uint64_t size;
+};
+
+
+static_assert(std::has_unique_object_representations_v<binary_snapshot_header>, "Headers are written as raw bytes and mustn't contain padding");
+
+
+/*! @brief Current version of the binary snapshot format. */
+inline constexpr std::uint32_t binary_snapshot_version = 3u;
+
+
+/**
+ * @brief Utility class to create binary snapshots from a registry.
+ *
+ * A binary snapshot dumps the packed array of entities and the packed array of
+ * components of each pool as contiguous blocks of bytes, each one preceded by
+ * a header that describes its content.<br/>
+ * Only trivially copyable components can be serialized this way. The output
+ * archive is a function object that accepts blocks of raw bytes:
+ *
+ * @code{.cpp}
+ * void(const void *data, std::size_t length);
+ * @endcode
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_binary_snapshot {
+    template<typename Type, typename Archive>
+    static void header(Archive &archive, const std::size_t sz, const std::size_t size_of = (is_empty_v<Type> ? 0u : sizeof(Type))) {
+        const binary_snapshot_header curr{
+            binary_snapshot_version,
+            static_cast<std::uint32_t>(size_of),
+            static_cast<std::uint32_t>(alignof(Type)),
+            0u,
+            static_cast<std::uint64_t>(type_hash<Type>::value()),
+            static_cast<std::uint64_t>(sz)
+        };
+
+        archive(static_cast<const void *>(&curr), sizeof(curr));
+    }
+
+    template<typename Component, typename Archive>
+    void dump(Archive &archive) const {
+        static_assert(std::is_trivially_copyable_v<Component>, "Binary snapshots require trivially copyable types");
+        const auto view = reg->template view<const Component>();
+        const auto sz = view.size();
+
+        header<Component>(archive, sz);
+        archive(static_cast<const void *>(view.data()), sz * sizeof(entity_type));
+
+        if constexpr(!is_empty_v<Component>) {
+            if constexpr(component_traits<Component>::paged_packed) {
+                [[maybe_unused]] std::vector<char> buffer{};
+
+                // each page is a contiguous block
+                for(std::size_t pos{}; pos < sz; pos += ENTT_PACKED_PAGE) {
+                    const auto count = (std::min)(sz - pos, std::size_t{ENTT_PACKED_PAGE});
+                    const void *page = view.raw()[pos / ENTT_PACKED_PAGE];
+
+                    if constexpr(component_traits<Component>::in_place_delete) {
+                        // slots behind tombstones still contain removed components, they're zeroed instead
+                        if(const auto *entt = view.data() + pos; std::find(entt, entt + count, null) != entt + count) {
+                            const auto *first = static_cast<const char *>(page);
+                            buffer.assign(first, first + count * sizeof(Component));
+
+                            for(std::size_t elem{}; elem < count; ++elem) {
+                                if(entt[elem] == null) {
+                                    std::memset(buffer.data() + elem * sizeof(Component), 0, sizeof(Component));
+                                }
+                            }
+
+                            page = buffer.data();
+                        }
+                    }
+
+                    archive(page, count * sizeof(Component));
+                }
+            } else {
+                archive(static_cast<const void *>(view.raw()), sz * sizeof(Component));
+            }
+        }
+    }
+
+    template<typename Component>
+    void block(std::vector<char> &buffer) const {
+        const auto sz = reg->template size<Component>();
+        buffer.reserve(sizeof(binary_snapshot_header) + sz * (sizeof(entity_type) + (is_empty_v<Component> ? 0u : sizeof(Component))));
+
+        auto archive = [&buffer](const void *data, const std::size_t length) {
+            const auto *first = static_cast<const char *>(data);
+            buffer.insert(buffer.end(), first, first + length);
+        };
+
+        dump<Component>(archive);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+
+    /**
+     * @brief Constructs an instance that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_binary_snapshot(const basic_registry<entity_type> &source) ENTT_NOEXCEPT
+        : reg{&source}
+    {}
+
+    /*! @brief Default move constructor. */
+    basic_binary_snapshot(basic_binary_snapshot &&) = default;
+
+    /*! @brief Default move assignment operator. @return This snapshot. */
+    basic_binary_snapshot & operator=(basic_binary_snapshot &&) = default;
+
+    /**
+     * @brief Puts aside all the entities from the underlying registry.
+     *
+     * Entities are serialized along with their versions. Destroyed entities are
+     * taken in consideration as well by this function.
+     *
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename Archive>
+    const basic_binary_snapshot & entities(Archive &archive) const {
+        const auto sz = reg->size();
+        const auto destroyed = reg->destroyed();
+
+        // blocks of entities don't have elements other than the entities themselves
+        header<entity_type>(archive, sz, 0u);
+        archive(static_cast<const void *>(reg->data()), sz * sizeof(entity_type));
+        archive(static_cast<const void *>(&destroyed), sizeof(destroyed));
+
+        return *this;
+    }
+
+    /**
+     * @brief Puts aside the given components.
+     *
+     * Each pool results in a block that contains its packed array of entities,
+     * followed by its packed array of components if any.
+     *
+     * @tparam Component Types of components to serialize.
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename... Component, typename Archive>
+    const basic_binary_snapshot & component(Archive &archive) const {
+        (dump<Component>(archive), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Puts aside the given components, one pool per task.
+     *
+     * Pools are serialized in parallel to separate buffers by means of the
+     * given executor (see `thread_pool` for further details). Buffers are then
+     * passed to the archive in the order in which types are provided, so that
+     * the result is exactly the same as that of the sequential version.<br/>
+     * The registry must not be modified until this function returns.
+     *
+     * @tparam Component Types of components to serialize.
+     * @tparam Archive Type of output archive.
+     * @tparam Exec Type of executor.
+     * @param archive A valid reference to an output archive.
+     * @param exec A valid executor.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename... Component, typename Archive, typename Exec>
+    const basic_binary_snapshot & component(Archive &archive, Exec &&exec) const {
+        using job_type = void(basic_binary_snapshot:: *)(std::vector<char> &) const;
+        const std::array<job_type, sizeof...(Component)> job{&basic_binary_snapshot::block<Component>...};
+        std::array<std::vector<char>, sizeof...(Component)> buffer{};
+
+        exec(sizeof...(Component), [this, &job, &buffer](const std::size_t pos) {
+            (this->*job[pos])(buffer[pos]);
+        });
+
+        for(auto &&curr: buffer) {
+            archive(static_cast<const void *>(curr.data()), curr.size());
+        }
+
+        return *this;
+    }
+
+private:
+    const basic_registry<entity_type> *reg;
+};
+
+
+/**
+ * @brief Utility class to restore a binary snapshot as a whole.
+ *
+ * A binary snapshot loader requires that the destination registry be empty and
+ * loads all the data at once while keeping intact the identifiers that the
+ * entities originally had. Components are assigned in bulk, pool by pool.<br/>
+ * The input archive is a function object that fills blocks of raw bytes:
+ *
+ * @code{.cpp}
+ * void(void *data, std::size_t length);
+ * @endcode
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_binary_snapshot_loader {
+    template<typename Type, typename Archive>
+    [[nodiscard]] bool header(Archive &archive, std::size_t &sz, const std::size_t size_of = (is_empty_v<Type> ? 0u : sizeof(Type))) {
+        binary_snapshot_header curr{};
+        archive(static_cast<void *>(&curr), sizeof(curr));
+
+        // blocks written by other builds or versions of the format are rejected, along with the rest of the archive
+        rejected = !(curr.version == binary_snapshot_version && curr.hash == type_hash<Type>::value() && curr.size_of == size_of && curr.align_of == alignof(Type));
+        sz = static_cast<std::size_t>(curr.size);
+
+        return !rejected;
+    }
+
+    template<typename Component, typename Archive>
+    void assign(Archive &archive) {
+        static_assert(std::is_trivially_copyable_v<Component>, "Binary snapshots require trivially copyable types");
+        std::size_t sz{};
+
+        if(rejected || !header<Component>(archive, sz)) {
+            return;
+        }
+
+        std::vector<entity_type> entt(sz);
+        archive(static_cast<void *>(entt.data()), entt.size() * sizeof(entity_type));
+
+        std::vector<std::conditional_t<is_empty_v<Component>, char, Component>> instance{};
+
+        if constexpr(!is_empty_v<Component>) {
+            instance.resize(entt.size());
+            archive(static_cast<void *>(instance.data()), instance.size() * sizeof(Component));
+        }
+
+        // tombstones of types deleted in place are dropped along with their slots
+        if(const auto first = std::find(entt.cbegin(), entt.cend(), null); first != entt.cend()) {
+            auto next = static_cast<std::size_t>(first - entt.cbegin());
+
+            for(auto pos = next; pos < entt.size(); ++pos) {
+                if(entt[pos] != null) {
+                    entt[next] = entt[pos];
+
+                    if constexpr(!is_empty_v<Component>) {
+                        instance[next] = instance[pos];
+                    }
+
+                    ++next;
+                }
+            }
+
+            entt.resize(next);
+            instance.resize(is_empty_v<Component> ? 0u : next);
+        }
+
+        for(auto curr: entt) {
+            if(!reg->valid(curr)) {
+                [[maybe_unused]] const auto entity = reg->create(curr);
+                ENTT_ASSERT(entity == curr);
+            }
+        }
+
+        if constexpr(is_empty_v<Component>) {
+            reg->template insert<Component>(entt.cbegin(), entt.cend());
+        } else {
+            reg->template insert<Component>(entt.cbegin(), entt.cend(), instance.cbegin(), instance.cend());
+        }
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+
+    /**
+     * @brief Constructs an instance that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_binary_snapshot_loader(basic_registry<entity_type> &source) ENTT_NOEXCEPT
+        : reg{&source},
+          rejected{}
+    {
+        // restoring a snapshot as a whole requires a clean registry
+        ENTT_ASSERT(reg->empty());
+    }
+
+    /*! @brief Default move constructor. */
+    basic_binary_snapshot_loader(basic_binary_snapshot_loader &&) = default;
+
+    /*! @brief Default move assignment operator. @return This loader. */
+    basic_binary_snapshot_loader & operator=(basic_binary_snapshot_loader &&) = default;
+
+    /**
+     * @brief Restores entities that were in use during serialization.
+     *
+     * This function restores the entities that were in use during serialization
+     * and gives them the versions they originally had.
+     *
+     * @tparam Archive Type of input archive.
+     * @param archive A valid reference to an input archive.
+     * @return A valid loader to continue restoring data.
+     */
+    template<typename Archive>
+    basic_binary_snapshot_loader & entities(Archive &archive) {
+        if(std::size_t sz{}; !rejected && header<entity_type>(archive, sz, 0u)) {
+            std::vector<entity_type> all(sz);
+            archive(static_cast<void *>(all.data()), all.size() * sizeof(entity_type));
+
+            entity_type destroyed;
+            archive(static_cast<void *>(&destroyed), sizeof(destroyed));
+
+            reg->assign(all.cbegin(), all.cend(), destroyed);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Restores components and assigns them to the right entities.
+     *
+     * The template parameter list must be exactly the same used during
+     * serialization. In the event that the entity to which the component is
+     * assigned doesn't exist yet, the loader will take care to create it with
+     * the version it originally had.
+     *
+     * @tparam Component Types of components to restore.
+     * @tparam Archive Type of input archive.
+     * @param archive A valid reference to an input archive.
+     * @return A valid loader to continue restoring data.
+     */
+    template<typename... Component, typename Archive>
+    basic_binary_snapshot_loader & component(Archive &archive) {
+        (assign<Component>(archive), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Destroys those entities that have no components.
+     * @return A valid loader to continue restoring data.
+     */
+    const basic_binary_snapshot_loader & orphans() const {
+        reg->orphans([this](const auto entt) {
+            reg->destroy(entt);
+        });
+
+        return *this;
+    }
+
+    /**
+     * @brief Checks if all the blocks read so far were accepted.
+     *
+     * Blocks are rejected if their headers don't match the types requested,
+     * for example because they were written by another build or version of
+     * the format. Once a block is rejected, the loader stops reading from the
+     * archive and the registry may have been partially restored.
+     *
+     * @return False if a block was rejected, true otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const ENTT_NOEXCEPT {
+        return !rejected;
+    }
+
+private:
+    basic_registry<entity_type> *reg;
+    bool rejected;
+};
+
+
+/**
+ * @brief Utility class to restore a binary snapshot from a memory region.
+ *
+ * A mapped snapshot loader works on a binary snapshot that is entirely
+ * available in memory, usually a read-only memory-mapped file. Blocks are
+ * located once upon construction by walking their headers, then pools are
+ * restored in bulk by copying entities and components straight from the
+ * region into the pools.<br/>
+ * Blocks can be restored in any order and those that aren't requested are
+ * never touched. In case of memory-mapped files, their pages aren't even read
+ * from disk.
+ *
+ * The loader doesn't take ownership of the region. It must outlive the loader.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_mapped_snapshot_loader {
+    template<typename Type>
+    class mapped_iterator final {
+        friend class basic_mapped_snapshot_loader<Entity>;
+
+        mapped_iterator(const char *ref) ENTT_NOEXCEPT
+            : data{ref}
+        {}
+
+    public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = Type;
+        using pointer = void;
+        using reference = value_type;
+        using iterator_category = std::forward_iterator_tag;
+
+        mapped_iterator & operator++() ENTT_NOEXCEPT {
+            return data += sizeof(Type), *this;
+        }
+
+        mapped_iterator operator++(int) ENTT_NOEXCEPT {
+            mapped_iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        [[nodiscard]] mapped_iterator operator+(const std::size_t value) const ENTT_NOEXCEPT {
+            return mapped_iterator{data + value * sizeof(Type)};
+        }
+
+        [[nodiscard]] reference operator*() const ENTT_NOEXCEPT {
+            // blocks aren't padded, elements are loaded from the region rather than referenced in place
+            Type instance;
+            std::memcpy(&instance, data, sizeof(Type));
+            return instance;
+        }
+
+        [[nodiscard]] bool operator==(const mapped_iterator &other) const ENTT_NOEXCEPT {
+            return other.data == data;
+        }
+
+        [[nodiscard]] bool operator!=(const mapped_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+    private:
+        const char *data;
+    };
+
+    [[nodiscard]] binary_snapshot_header header(const std::size_t offset) const {
+        binary_snapshot_header curr{};
+        std::memcpy(&curr, region + offset, sizeof(curr));
+        return curr;
+    }
+
+    [[nodiscard]] bool locate() {
+        for(size_type offset{}; offset < length;) {
+            if(length - offset < sizeof(binary_snapshot_header)) {
+                return false;
+            }
+
+            const auto curr = header(offset);
+            // blocks of entities are followed by the head of the list of destroyed entities
+            const std::uint64_t extra = (curr.hash == type_hash<entity_type>::value() && !curr.size_of) ? sizeof(entity_type) : 0u;
+            const std::uint64_t available = length - offset - sizeof(curr);
+            const std::uint64_t size_of = std::uint64_t{sizeof(entity_type)} + curr.size_of;
+
+            // sizes are validated by division, they can't overflow nor exceed the region
+            if(curr.version != binary_snapshot_version || available < extra || (available - extra) / size_of < curr.size) {
+                return false;
+            }
+
+            blocks.push_back(offset);
+            offset += sizeof(curr) + static_cast<size_type>(curr.size * size_of + extra);
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] const char * find(const id_type hash, const std::size_t size_of, const std::size_t align_of, binary_snapshot_header &curr) const {
+        for(const auto offset: blocks) {
+            if(curr = header(offset); curr.hash == hash && curr.size_of == size_of && curr.align_of == align_of) {
+                return region + offset + sizeof(curr);
+            }
+        }
+
+        return nullptr;
+    }
+
+    template<typename Component>
+    void assign() const {
+        static_assert(std::is_trivially_copyable_v<Component>, "Binary snapshots require trivially copyable types");
+        binary_snapshot_header curr{};
+
+        if(const auto *data = find(type_hash<Component>::value(), is_empty_v<Component> ? 0u : sizeof(Component), alignof(Component), curr); data) {
+            const auto sz = static_cast<std::size_t>(curr.size);
+            const mapped_iterator<entity_type> entt{data};
+            [[maybe_unused]] const mapped_iterator<Component> instance{data + sz * sizeof(entity_type)};
+            std::size_t first{};
+
+            for(std::size_t pos{}; pos <= sz; ++pos) {
+                // tombstones of types deleted in place split the block in runs of entities
+                if(const auto other = (pos == sz) ? entity_type{null} : *(entt + pos); other != null) {
+                    if(!reg->valid(other)) {
+                        [[maybe_unused]] const auto entity = reg->create(other);
+                        ENTT_ASSERT(entity == other);
+                    }
+                } else {
+                    if(first != pos) {
+                        if constexpr(is_empty_v<Component>) {
+                            reg->template insert<Component>(entt + first, entt + pos);
+                        } else {
+                            reg->template insert<Component>(entt + first, entt + pos, instance + first, instance + pos);
+                        }
+                    }
+
+                    first = pos + 1u;
+                }
+            }
+        }
+    }
+
+    template<typename Component>
+    void prepare() const {
+        binary_snapshot_header curr{};
+        std::size_t count{};
+
+        if(const auto *data = find(type_hash<Component>::value(), is_empty_v<Component> ? 0u : sizeof(Component), alignof(Component), curr); data) {
+            for(std::size_t pos{}, sz = static_cast<std::size_t>(curr.size); pos < sz; ++pos) {
+                entity_type entt;
+                std::memcpy(&entt, data + pos * sizeof(entity_type), sizeof(entt));
+
+                if(entt != null) {
+                    if(!reg->valid(entt)) {
+                        [[maybe_unused]] const auto entity = reg->create(entt);
+                        ENTT_ASSERT(entity == entt);
+                    }
+
+                    ++count;
+                }
+            }
+        }
+
+        reg->template reserve<Component>(reg->template size<Component>() + count);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an instance that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     * @param data A pointer to the memory region that contains the snapshot.
+     * @param size The size of the memory region in bytes.
+     */
+    basic_mapped_snapshot_loader(basic_registry<entity_type> &source, const void *data, const size_type size)
+        : reg{&source},
+          region{static_cast<const char *>(data)},
+          length{size},
+          blocks{},
+          rejected{}
+    {
+        // restoring a snapshot as a whole requires a clean registry
+        ENTT_ASSERT(reg->empty());
+
+        if(!locate()) {
+            // truncated or corrupted regions are rejected as a whole
+            blocks.clear();
+            rejected = true;
+        }
+    }
+
+    /*! @brief Default move constructor. */
+    basic_mapped_snapshot_loader(basic_mapped_snapshot_loader &&) = default;
+
+    /*! @brief Default move assignment operator. @return This loader. */
+    basic_mapped_snapshot_loader & operator=(basic_mapped_snapshot_loader &&) = default;
+
+    /**
+     * @brief Restores entities that were in use during serialization.
+     *
+     * This function restores the entities that were in use during serialization
+     * and gives them the versions they originally had.
+     *
+     * @return A valid loader to continue restoring data.
+     */
+    const basic_mapped_snapshot_loader & entities() const {
+        binary_snapshot_header curr{};
+
+        if(const auto *data = find(type_hash<entity_type>::value(), 0u, alignof(entity_type), curr); data) {
+            std::vector<entity_type> all(static_cast<size_type>(curr.size));
+            entity_type destroyed;
+
+            std::memcpy(all.data(), data, all.size() * sizeof(entity_type));
+            std::memcpy(&destroyed, data + all.size() * sizeof(entity_type), sizeof(destroyed));
+            reg->assign(all.cbegin(), all.cend(), destroyed);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Restores components and assigns them to the right entities.
+     *
+     * Types of components can be restored in any order, also different from
+     * the one used during serialization. Types that aren't part of the snapshot
+     * are ignored. In the event that the entity to which the component is
+     * assigned doesn't exist yet, the loader will take care to create it with
+     * the version it originally had.
+     *
+     * @tparam Component Types of components to restore.
+     * @return A valid loader to continue restoring data.
+     */
+    template<typename... Component>
+    const basic_mapped_snapshot_loader & component() const {
+        (assign<Component>(), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Restores components in parallel, one pool per task.
+     *
+     * Missing entities are created and pools are prepared up front on the
+     * calling thread. Then pools are restored in parallel by means of the
+     * given executor (see `thread_pool` for further details).
+     *
+     * @warning
+     * Pools are filled concurrently. Therefore, listeners attached to their
+     * signals must not access other pools nor the registry. In particular, no
+     * group can refer to more than one of the given components, since its
+     * handlers would run on different threads at once.<br/>
+     * An assertion will abort the execution at runtime in debug mode if a
+     * group refers to more than one of the given components.
+     *
+     * @tparam Component Types of components to restore.
+     * @tparam Exec Type of executor.
+     * @param exec A valid executor.
+     * @return A valid loader to continue restoring data.
+     */
+    template<typename... Component, typename Exec>
+    const basic_mapped_snapshot_loader & component(Exec &&exec) const {
+        using job_type = void(basic_mapped_snapshot_loader:: *)() const;
+        const std::array<job_type, sizeof...(Component)> job{&basic_mapped_snapshot_loader::assign<Component>...};
+
+        ENTT_ASSERT(reg->template independent<Component...>());
+        (prepare<Component>(), ...);
+
+        exec(sizeof...(Component), [this, &job](const std::size_t pos) {
+            (this->*job[pos])();
+        });
+
+        return *this;
+    }
+
+    /**
+     * @brief Checks if a snapshot contains the given type of component.
+     * @tparam Component Type of component to look for.
+     * @return True if the snapshot contains the given type, false otherwise.
+     */
+    template<typename Component>
+    [[nodiscard]] bool contains() const {
+        binary_snapshot_header curr{};
+        return find(type_hash<Component>::value(), is_empty_v<Component> ? 0u : sizeof(Component), alignof(Component), curr) != nullptr;
+    }
+
+    /**
+     * @brief Destroys those entities that have no components.
+     * @return A valid loader to continue restoring data.
+     */
+    const basic_mapped_snapshot_loader & orphans() const {
+        reg->orphans([this](const auto entt) {
+            reg->destroy(entt);
+        });
+
+        return *this;
+    }
+
+    /**
+     * @brief Checks if the memory region was accepted.
+     *
+     * Regions are rejected as a whole if they are truncated, if the sizes of
+     * their blocks are corrupted or if they were written by another version of
+     * the format. A rejected region contains no blocks and nothing is restored
+     * from it.
+     *
+     * @return False if the region was rejected, true otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const ENTT_NOEXCEPT {
+        return !rejected;
+    }
+
+private:
+    basic_registry<entity_type> *reg;
+    const char *region;
+    size_type length;
+    std::vector<size_type> blocks;
+    bool rejected;
+};
+
 }
 
 
@@ -2,11 +2,13 @@
 #define ENTT_ENTITY_SPARSE_SET_HPP
 
 
+#include <algorithm>
 #include <iterator>
 #include <utility>
 #include <vector>
 #include <memory>
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 #include "../config/config.h"
 #include "../core/algorithm.hpp"
@@ -17,6 +19,15 @@
 namespace entt {
 
 
+/*! @brief Sparse set deletion policy. */
+enum class deletion_policy: std::uint8_t {
+    /*! @brief Swap-and-pop deletion policy. */
+    swap_and_pop = 0u,
+    /*! @brief In-place deletion policy. */
+    in_place = 1u
+};
+
+
 /**
  * @brief Basic sparse set implementation.
  *
@@ -37,6 +48,12 @@ namespace entt {
  * no guarantees that entities are returned in the insertion order when iterate
  * a sparse set. Do not make assumption on the order in any case.
  *
+ * @note
+ * Sparse sets that use the in-place deletion policy don't move entities around
+ * when one of them is removed. The freed slot is marked with a tombstone (the
+ * null entity) in the packed array and reused by the next insertion. Users
+ * that walk the packed array of these sets must skip tombstones explicitly.
+ *
  * @tparam Entity A valid entity type (see entt_traits for more details).
  */
 template<typename Entity>
@@ -173,8 +190,16 @@ class basic_sparse_set {
         return sparse[pos];
     }
 
+protected:
+    /*! @brief Swaps two elements in the packed array of a derived class. */
     virtual void swap_at(const std::size_t, const std::size_t) {}
+    /*! @brief Moves the last element in place of a removed one. */
     virtual void swap_and_pop(const std::size_t) {}
+    /*! @brief Destroys an element and leaves a tombstone in its place. */
+    virtual void in_place_pop(const std::size_t) {}
+    /*! @brief Moves an element to a free slot when compacting. */
+    virtual void move_and_pop(const std::size_t, const std::size_t) {}
+    /*! @brief Destroys all the elements of a derived class. */
     virtual void clear_all() {}
 
 public:
@@ -190,6 +215,24 @@ public:
     /*! @brief Default constructor. */
     basic_sparse_set() = default;
 
+    /**
+     * @brief Constructs an empty sparse set with the given deletion policy.
+     * @param pol Type of deletion policy.
+     */
+    explicit basic_sparse_set(const deletion_policy pol)
+        : mode{pol}
+    {}
+
+    /**
+     * @brief Copy constructor.
+     * @param other The instance to copy from.
+     */
+    basic_sparse_set(const basic_sparse_set &other)
+        : basic_sparse_set{}
+    {
+        *this = other;
+    }
+
     /*! @brief Default move constructor. */
     basic_sparse_set(basic_sparse_set &&) = default;
 
@@ -199,6 +242,39 @@ public:
     /*! @brief Default move assignment operator. @return This sparse set. */
     basic_sparse_set & operator=(basic_sparse_set &&) = default;
 
+    /**
+     * @brief Copy assignment operator.
+     *
+     * Pages already allocated by the sparse set are reused rather than
+     * released, so that repeated copies don't hit the allocator.
+     *
+     * @param other The instance to copy from.
+     * @return This sparse set.
+     */
+    basic_sparse_set & operator=(const basic_sparse_set &other) {
+        if(this != &other) {
+            sparse.resize((std::max)(sparse.size(), other.sparse.size()));
+
+            for(size_type pos{}, last = sparse.size(); pos < last; ++pos) {
+                if(pos < other.sparse.size() && other.sparse[pos]) {
+                    if(!sparse[pos]) {
+                        sparse[pos].reset(new entity_type[entt_per_page]);
+                    }
+
+                    std::copy(other.sparse[pos].get(), other.sparse[pos].get() + entt_per_page, sparse[pos].get());
+                } else if(sparse[pos]) {
+                    std::fill(sparse[pos].get(), sparse[pos].get() + entt_per_page, entity_type{null});
+                }
+            }
+
+            packed = other.packed;
+            free_list = other.free_list;
+            mode = other.mode;
+        }
+
+        return *this;
+    }
+
     /**
      * @brief Increases the capacity of a sparse set.
      *
@@ -253,6 +329,10 @@ public:
      * Usually the size of the internal sparse array is equal or greater than
      * the one of the internal packed array.
      *
+     * @note
+     * Tombstones left behind by the in-place deletion policy are part of the
+     * packed array and therefore they are counted as well.
+     *
      * @return Number of elements.
      */
     [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
@@ -267,6 +347,27 @@ public:
         return packed.empty();
     }
 
+    /**
+     * @brief Returns the deletion policy of a sparse set.
+     * @return The deletion policy of the sparse set.
+     */
+    [[nodiscard]] deletion_policy policy() const ENTT_NOEXCEPT {
+        return mode;
+    }
+
+    /**
+     * @brief Returns the position of the next slot to use for an insertion.
+     *
+     * This is the position of the most recently freed slot for sparse sets
+     * that use the in-place deletion policy, the end of the packed array in
+     * all other cases.
+     *
+     * @return The position of the next slot to use for an insertion.
+     */
+    [[nodiscard]] size_type slot() const ENTT_NOEXCEPT {
+        return free_list.empty() ? packed.size() : free_list.back();
+    }
+
     /**
      * @brief Direct access to the internal packed array.
      *
@@ -386,13 +487,24 @@ public:
      */
     void emplace(const entity_type entt) {
         ENTT_ASSERT(!contains(entt));
-        assure(page(entt))[offset(entt)] = entity_type{static_cast<typename traits_type::entity_type>(packed.size())};
-        packed.push_back(entt);
+
+        if(free_list.empty()) {
+            assure(page(entt))[offset(entt)] = entity_type{static_cast<typename traits_type::entity_type>(packed.size())};
+            packed.push_back(entt);
+        } else {
+            const auto pos = free_list.back();
+            assure(page(entt))[offset(entt)] = entity_type{static_cast<typename traits_type::entity_type>(pos)};
+            packed[pos] = entt;
+            free_list.pop_back();
+        }
     }
 
     /**
      * @brief Assigns one or more entities to a sparse set.
      *
+     * Entities are always appended to the packed array, slots freed by the
+     * in-place deletion policy aren't reused by this function.
+     *
      * @warning
      * Attempting to assign an entity that already belongs to the sparse set
      * results in undefined behavior.
@@ -425,14 +537,28 @@ public:
         ENTT_ASSERT(contains(entt));
         auto &ref = sparse[page(entt)][offset(entt)];
         const auto pos = size_type{to_integral(ref)};
-        const auto other = packed.back();
 
-        sparse[page(other)][offset(other)] = ref;
-        packed[pos] = other;
-        ref = null;
+        if(mode == deletion_policy::in_place) {
+            packed[pos] = null;
+            ref = null;
+            free_list.push_back(pos);
+            in_place_pop(pos);
 
-        packed.pop_back();
-        swap_and_pop(pos);
+            if(free_list.size() == packed.size()) {
+                // only tombstones left, nothing to destroy
+                free_list.clear();
+                packed.clear();
+            }
+        } else {
+            const auto other = packed.back();
+
+            sparse[page(other)][offset(other)] = ref;
+            packed[pos] = other;
+            ref = null;
+
+            packed.pop_back();
+            swap_and_pop(pos);
+        }
     }
 
     /**
@@ -507,6 +633,7 @@ public:
     template<typename Compare, typename Sort = std_sort, typename... Args>
     void sort_n(const size_type count, Compare compare, Sort algo = Sort{}, Args &&... args) {
         ENTT_ASSERT(!(count > size()));
+        ENTT_ASSERT(free_list.empty());
 
         algo(packed.rend() - count, packed.rend(), std::move(compare), std::forward<Args>(args)...);
 
@@ -557,6 +684,7 @@ public:
      * @param other The sparse sets that imposes the order of the entities.
      */
     void respect(const basic_sparse_set &other) {
+        ENTT_ASSERT(free_list.empty());
         const auto to = other.end();
         auto from = other.begin();
 
@@ -575,16 +703,48 @@ public:
         }
     }
 
+    /**
+     * @brief Removes all tombstones from the packed array of a sparse set.
+     *
+     * Entities are moved to fill the holes left by the in-place deletion
+     * policy. References to the elements of a sparse set are invalidated
+     * afterwards. This function is a no-op for sparse sets that use the
+     * swap-and-pop deletion policy.
+     */
+    void compact() {
+        std::sort(free_list.begin(), free_list.end());
+
+        for(auto first = free_list.cbegin(), last = free_list.cend(); first != last; ++first) {
+            for(; !packed.empty() && packed.back() == null; packed.pop_back());
+
+            if(const auto pos = *first; pos < packed.size()) {
+                const auto from = packed.size() - 1u;
+                const auto entt = packed.back();
+                sparse[page(entt)][offset(entt)] = entity_type{static_cast<typename traits_type::entity_type>(pos)};
+                packed[pos] = entt;
+                packed.pop_back();
+                move_and_pop(from, pos);
+            }
+        }
+
+        for(; !packed.empty() && packed.back() == null; packed.pop_back());
+        free_list.clear();
+    }
+
     /*! @brief Clears a sparse set. */
     void clear() ENTT_NOEXCEPT {
+        // derived classes can still look at the packed array
+        clear_all();
         sparse.clear();
         packed.clear();
-        clear_all();
+        free_list.clear();
     }
 
 private:
     std::vector<page_type> sparse;
     std::vector<entity_type> packed;
+    std::vector<size_type> free_list;
+    deletion_policy mode{};
 };
 
 
@@ -4,7 +4,10 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
+#include <limits>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -13,6 +16,7 @@
 #include "../core/algorithm.hpp"
 #include "../core/type_traits.hpp"
 #include "../signal/sigh.hpp"
+#include "component.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 #include "sparse_set.hpp"
@@ -21,6 +25,31 @@
 namespace entt {
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+[[nodiscard]] constexpr bool is_tick_after(const tick_type curr, const tick_type tick) ENTT_NOEXCEPT {
+    // ticks wrap around, those up to half the range ahead are considered newer
+    const auto diff = static_cast<tick_type>(curr - tick);
+    return diff && !((std::numeric_limits<tick_type>::max)() / 2u < diff);
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
 /*! @brief Empty storage category tag. */
 struct empty_storage_tag {};
 /*! @brief Dense storage category tag. */
@@ -45,6 +74,16 @@ struct dense_storage_tag: empty_storage_tag {};
  * no guarantees that objects are returned in the insertion order when iterate
  * a storage. Do not make assumption on the order in any case.
  *
+ * @note
+ * Objects are kept in a single contiguous array by default. Types for which
+ * `component_traits<Type>::paged_packed` is true are arranged in fixed-size
+ * pages instead and are never relocated when the storage grows.
+ *
+ * @note
+ * Types for which `component_traits<Type>::in_place_delete` is true are never
+ * moved around when an entity is removed. References to these objects remain
+ * valid until the objects themselves are destroyed or `compact` is invoked.
+ *
  * @warning
  * Empty types aren't explicitly instantiated. Therefore, many of the functions
  * normally available for non-empty types will not be available for empty ones.
@@ -57,15 +96,23 @@ struct dense_storage_tag: empty_storage_tag {};
 template<typename Entity, typename Type, typename = void>
 class basic_storage: public basic_sparse_set<Entity> {
     static_assert(std::is_move_constructible_v<Type> && std::is_move_assignable_v<Type>, "The managed type must be at least move constructible and assignable");
+    static_assert(ENTT_PACKED_PAGE && ((ENTT_PACKED_PAGE & (ENTT_PACKED_PAGE - 1)) == 0), "ENTT_PACKED_PAGE must be a power of two");
+    static_assert(!component_traits<Type>::in_place_delete || component_traits<Type>::paged_packed, "Types deleted in place require a paged packed array");
+    static constexpr auto comp_per_page = ENTT_PACKED_PAGE;
+    static constexpr bool paged = component_traits<Type>::paged_packed;
 
     using underlying_type = basic_sparse_set<Entity>;
     using traits_type = entt_traits<Entity>;
+    using alloc_type = std::allocator<Type>;
+    using alloc_traits = std::allocator_traits<alloc_type>;
+    using raw_pointer = std::conditional_t<paged, Type **, Type *>;
+    using const_raw_pointer = std::conditional_t<paged, const Type * const *, const Type *>;
 
     template<typename Value>
     class storage_iterator final {
         friend class basic_storage<Entity, Type>;
 
-        using instance_type = constness_as_t<std::vector<Type>, Value>;
+        using instance_type = constness_as_t<std::vector<Type *>, Value>;
         using index_type = typename traits_type::difference_type;
 
         storage_iterator(instance_type &ref, const index_type idx) ENTT_NOEXCEPT
@@ -123,7 +170,7 @@ class basic_storage: public basic_sparse_set<Entity> {
 
         [[nodiscard]] reference operator[](const difference_type value) const ENTT_NOEXCEPT {
             const auto pos = size_type(index-value-1);
-            return (*instances)[pos];
+            return (*instances)[page(pos)][offset(pos)];
         }
 
         [[nodiscard]] bool operator==(const storage_iterator &other) const ENTT_NOEXCEPT {
@@ -152,7 +199,7 @@ class basic_storage: public basic_sparse_set<Entity> {
 
         [[nodiscard]] pointer operator->() const ENTT_NOEXCEPT {
             const auto pos = size_type(index-1u);
-            return &(*instances)[pos];
+            return &(*instances)[page(pos)][offset(pos)];
         }
 
         [[nodiscard]] reference operator*() const ENTT_NOEXCEPT {
@@ -164,18 +211,246 @@ class basic_storage: public basic_sparse_set<Entity> {
         index_type index;
     };
 
-    void swap_at(const std::size_t lhs, const std::size_t rhs) final {
-        std::swap(instances[lhs], instances[rhs]);
+    [[nodiscard]] static constexpr std::size_t page(const std::size_t pos) ENTT_NOEXCEPT {
+        if constexpr(paged) {
+            return pos / comp_per_page;
+        } else {
+            // the contiguous array is the one and only page
+            return {};
+        }
     }
 
-    void swap_and_pop(const std::size_t pos) final {
-        auto other = std::move(instances.back());
-        instances[pos] = std::move(other);
-        instances.pop_back();
+    [[nodiscard]] static constexpr std::size_t offset(const std::size_t pos) ENTT_NOEXCEPT {
+        if constexpr(paged) {
+            return pos & (comp_per_page - 1);
+        } else {
+            return pos;
+        }
+    }
+
+    [[nodiscard]] std::size_t page_size() const ENTT_NOEXCEPT {
+        if constexpr(paged) {
+            return comp_per_page;
+        } else {
+            return reserved;
+        }
+    }
+
+    [[nodiscard]] Type * element_at(const std::size_t pos) const ENTT_NOEXCEPT {
+        return instances[page(pos)] + offset(pos);
+    }
+
+    void relocate(const std::size_t cap, const std::size_t count) {
+        // moves the first count objects of the contiguous array to a new one of the given capacity
+        alloc_type allocator{};
+        instances.reserve(1u);
+        relocation_guard guard{cap ? alloc_traits::allocate(allocator, cap) : nullptr, cap};
+
+        if(count) {
+            if constexpr(std::is_nothrow_move_constructible_v<Type> || !std::is_copy_constructible_v<Type>) {
+                std::uninitialized_move_n(instances.front(), count, guard.block);
+            } else {
+                // the original objects are left untouched if a copy throws
+                std::uninitialized_copy_n(instances.front(), count, guard.block);
+            }
+
+            std::destroy_n(instances.front(), count);
+        }
+
+        if(!instances.empty()) {
+            alloc_traits::deallocate(allocator, instances.front(), reserved);
+            instances.clear();
+        }
+
+        if(guard.block) {
+            instances.push_back(std::exchange(guard.block, nullptr));
+        }
+
+        reserved = cap;
+    }
+
+    void maybe_resize_packed(const std::size_t req) {
+        if constexpr(paged) {
+            if(const auto length = (req + comp_per_page - 1u) / comp_per_page; instances.size() < length) {
+                alloc_type allocator{};
+                instances.reserve(length);
+
+                while(instances.size() < length) {
+                    instances.push_back(alloc_traits::allocate(allocator, comp_per_page));
+                }
+            }
+        } else if(reserved < req) {
+            relocate((std::max)(req, reserved * 2u), underlying_type::size());
+        }
     }
 
-    void clear_all() ENTT_NOEXCEPT final {
+    void release_memory() ENTT_NOEXCEPT {
+        alloc_type allocator{};
+        clear_all();
+
+        for(auto *curr: instances) {
+            alloc_traits::deallocate(allocator, curr, page_size());
+        }
+
         instances.clear();
+        reserved = {};
+    }
+
+    void copy_instances(const basic_storage &other) {
+        truncation_guard guard{this, 0u};
+        underlying_type::operator=(other);
+
+        const auto sz = underlying_type::size();
+
+        if constexpr(paged) {
+            maybe_resize_packed(sz);
+        } else if(reserved < sz) {
+            // there are no objects left to move
+            relocate(sz, 0u);
+        }
+
+        if constexpr(std::is_trivially_copyable_v<Type>) {
+            for(std::size_t pos{}, step = paged ? comp_per_page : sz; pos < sz; pos += step) {
+                std::memcpy(static_cast<void *>(element_at(pos)), other.element_at(pos), (std::min)(sz - pos, step) * sizeof(Type));
+            }
+        } else {
+            for(alloc_type allocator{}; guard.count < sz; ++guard.count) {
+                if constexpr(component_traits<Type>::in_place_delete) {
+                    if(underlying_type::data()[guard.count] == null) {
+                        continue;
+                    }
+                }
+
+                alloc_traits::construct(allocator, element_at(guard.count), *other.element_at(guard.count));
+            }
+        }
+
+        guard.owner = nullptr;
+    }
+
+    template<typename... Args>
+    [[nodiscard]] static Type make(Args &&... args) {
+        if constexpr(std::is_aggregate_v<Type>) {
+            return Type{std::forward<Args>(args)...};
+        } else {
+            return Type(std::forward<Args>(args)...);
+        }
+    }
+
+    template<typename... Args>
+    Type * construct_at(const std::size_t pos, Args &&... args) {
+        alloc_type allocator{};
+        auto *elem = element_at(pos);
+
+        if constexpr(std::is_aggregate_v<Type>) {
+            alloc_traits::construct(allocator, elem, Type{std::forward<Args>(args)...});
+        } else {
+            alloc_traits::construct(allocator, elem, std::forward<Args>(args)...);
+        }
+
+        return elem;
+    }
+
+    struct construction_guard {
+        // destroys the objects constructed so far, unless released
+        ~construction_guard() {
+            if(owner) {
+                alloc_type allocator{};
+
+                for(; from < to; ++from) {
+                    alloc_traits::destroy(allocator, owner->element_at(from));
+                }
+            }
+        }
+
+        basic_storage *owner;
+        std::size_t from;
+        std::size_t to;
+    };
+
+    struct relocation_guard {
+        // releases the new contiguous array, unless it has been taken over
+        ~relocation_guard() {
+            if(block) {
+                alloc_type allocator{};
+                alloc_traits::deallocate(allocator, block, cap);
+            }
+        }
+
+        Type *block;
+        std::size_t cap;
+    };
+
+    struct truncation_guard {
+        // destroys the objects copied so far and empties the sparse set without touching them again, unless released
+        ~truncation_guard() {
+            if(owner) {
+                alloc_type allocator{};
+
+                for(; count; --count) {
+                    if constexpr(component_traits<Type>::in_place_delete) {
+                        if(owner->underlying_type::data()[count - 1u] == null) {
+                            continue;
+                        }
+                    }
+
+                    alloc_traits::destroy(allocator, owner->element_at(count - 1u));
+                }
+
+                // copying an empty sparse set doesn't allocate and keeps the pages
+                owner->underlying_type::operator=(underlying_type{owner->policy()});
+            }
+        }
+
+        basic_storage *owner;
+        std::size_t count;
+    };
+
+protected:
+    /*! @copydoc basic_sparse_set::swap_at */
+    void swap_at(const std::size_t lhs, const std::size_t rhs) override {
+        std::swap(*element_at(lhs), *element_at(rhs));
+    }
+
+    /*! @copydoc basic_sparse_set::swap_and_pop */
+    void swap_and_pop(const std::size_t pos) override {
+        alloc_type allocator{};
+        // the sparse set has already dropped the last entity, it's where the last object is
+        auto *last = element_at(underlying_type::size());
+        auto other = std::move(*last);
+        *element_at(pos) = std::move(other);
+        alloc_traits::destroy(allocator, last);
+    }
+
+    /*! @copydoc basic_sparse_set::in_place_pop */
+    void in_place_pop(const std::size_t pos) override {
+        alloc_type allocator{};
+        alloc_traits::destroy(allocator, element_at(pos));
+    }
+
+    /*! @copydoc basic_sparse_set::move_and_pop */
+    void move_and_pop(const std::size_t from, const std::size_t to) override {
+        alloc_type allocator{};
+        auto *elem = element_at(from);
+        alloc_traits::construct(allocator, element_at(to), std::move(*elem));
+        alloc_traits::destroy(allocator, elem);
+    }
+
+    /*! @copydoc basic_sparse_set::clear_all */
+    void clear_all() ENTT_NOEXCEPT override {
+        if constexpr(!std::is_trivially_destructible_v<Type>) {
+            alloc_type allocator{};
+
+            for(auto pos = underlying_type::size(); pos; --pos) {
+                if constexpr(component_traits<Type>::in_place_delete) {
+                    if(underlying_type::data()[pos - 1u] == null) {
+                        continue;
+                    }
+                }
+
+                alloc_traits::destroy(allocator, element_at(pos - 1u));
+            }
+        }
     }
 
 public:
@@ -190,29 +465,112 @@ public:
     /*! @brief Constant random access iterator type. */
     using const_iterator = storage_iterator<const Type>;
     /*! @brief Reverse iterator type. */
-    using reverse_iterator = Type *;
+    using reverse_iterator = std::conditional_t<paged, std::reverse_iterator<iterator>, Type *>;
     /*! @brief Constant reverse iterator type. */
-    using const_reverse_iterator = const Type *;
+    using const_reverse_iterator = std::conditional_t<paged, std::reverse_iterator<const_iterator>, const Type *>;
     /*! @brief Storage category. */
     using storage_category = dense_storage_tag;
 
+    /*! @brief Default constructor. */
+    basic_storage()
+        : underlying_type{component_traits<Type>::in_place_delete ? deletion_policy::in_place : deletion_policy::swap_and_pop}
+    {}
+
+    /**
+     * @brief Copy constructor.
+     *
+     * Pages of trivially copyable objects are copied as blocks of bytes,
+     * tombstones included. Other objects are copied one at a time.
+     *
+     * @param other The instance to copy from.
+     */
+    basic_storage(const basic_storage &other)
+        : basic_storage{}
+    {
+        // the object is fully constructed at this point, the destructor releases the pages if the copy throws
+        copy_instances(other);
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_storage(basic_storage &&other) ENTT_NOEXCEPT
+        : underlying_type{std::move(other)},
+          instances{std::exchange(other.instances, {})},
+          reserved{std::exchange(other.reserved, 0u)}
+    {}
+
+    /*! @brief Default destructor. */
+    ~basic_storage() override {
+        release_memory();
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_storage & operator=(basic_storage &&other) ENTT_NOEXCEPT {
+        release_memory();
+        underlying_type::operator=(std::move(other));
+        instances = std::exchange(other.instances, {});
+        reserved = std::exchange(other.reserved, 0u);
+        return *this;
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * Pages already allocated by the storage are reused rather than released.
+     * Objects are copied as described for the copy constructor. If a copy
+     * throws, the storage is left empty and keeps its pages.
+     *
+     * @param other The instance to copy from.
+     * @return This storage.
+     */
+    basic_storage & operator=(const basic_storage &other) {
+        if(this != &other) {
+            clear_all();
+            copy_instances(other);
+        }
+
+        return *this;
+    }
+
     /**
      * @brief Increases the capacity of a storage.
      *
      * If the new capacity is greater than the current capacity, new storage is
-     * allocated, otherwise the method does nothing.
+     * allocated, otherwise the method does nothing.<br/>
+     * The storage can make room for more elements than requested, either
+     * because objects are allocated in pages or because the contiguous array
+     * grows geometrically.
      *
      * @param cap Desired capacity.
      */
     void reserve(const size_type cap) {
         underlying_type::reserve(cap);
-        instances.reserve(cap);
+        maybe_resize_packed(cap);
     }
 
     /*! @brief Requests the removal of unused capacity. */
     void shrink_to_fit() {
         underlying_type::shrink_to_fit();
-        instances.shrink_to_fit();
+
+        if constexpr(paged) {
+            alloc_type allocator{};
+            const auto length = (underlying_type::size() + comp_per_page - 1u) / comp_per_page;
+
+            for(auto pos = length, last = instances.size(); pos < last; ++pos) {
+                alloc_traits::deallocate(allocator, instances[pos], comp_per_page);
+            }
+
+            instances.resize(length);
+            instances.shrink_to_fit();
+        } else if(const auto sz = underlying_type::size(); sz < reserved) {
+            relocate(sz, sz);
+        }
     }
 
     /**
@@ -221,19 +579,33 @@ public:
      * The returned pointer is such that range `[raw(), raw() + size())` is
      * always a valid range, even if the container is empty.
      *
+     * For types with a paged packed array, the function returns a pointer to
+     * the array of pages instead. Objects are arranged in pages of
+     * `ENTT_PACKED_PAGE` elements and the object in position `pos` is found as
+     * `raw()[pos / ENTT_PACKED_PAGE][pos % ENTT_PACKED_PAGE]`. Each page is a
+     * contiguous array of objects and all pages but the last one are full.
+     *
      * @note
      * Objects are in the reverse order as returned by the `begin`/`end`
      * iterators.
      *
-     * @return A pointer to the array of objects.
+     * @return A pointer to the array of objects or to the array of pages.
      */
-    [[nodiscard]] const value_type * raw() const ENTT_NOEXCEPT {
-        return instances.data();
+    [[nodiscard]] const_raw_pointer raw() const ENTT_NOEXCEPT {
+        if constexpr(paged) {
+            return instances.data();
+        } else {
+            return instances.empty() ? nullptr : instances.front();
+        }
     }
 
     /*! @copydoc raw */
-    [[nodiscard]] value_type * raw() ENTT_NOEXCEPT {
-        return const_cast<value_type *>(std::as_const(*this).raw());
+    [[nodiscard]] raw_pointer raw() ENTT_NOEXCEPT {
+        if constexpr(paged) {
+            return instances.data();
+        } else {
+            return instances.empty() ? nullptr : instances.front();
+        }
     }
 
     /**
@@ -242,6 +614,11 @@ public:
      * The returned iterator points to the first instance of the internal array.
      * If the storage is empty, the returned iterator will be equal to `end()`.
      *
+     * @warning
+     * For types deleted in place, the range also contains the slots of the
+     * removed objects. These are matched by tombstones in the packed array of
+     * entities and must not be accessed.
+     *
      * @return An iterator to the first instance of the internal array.
      */
     [[nodiscard]] const_iterator cbegin() const ENTT_NOEXCEPT {
@@ -294,7 +671,11 @@ public:
      * @return An iterator to the first instance of the reversed internal array.
      */
     [[nodiscard]] const_reverse_iterator crbegin() const ENTT_NOEXCEPT {
-        return instances.data();
+        if constexpr(paged) {
+            return std::make_reverse_iterator(cend());
+        } else {
+            return raw();
+        }
     }
 
     /*! @copydoc crbegin */
@@ -304,7 +685,11 @@ public:
 
     /*! @copydoc rbegin */
     [[nodiscard]] reverse_iterator rbegin() ENTT_NOEXCEPT {
-        return instances.data();
+        if constexpr(paged) {
+            return std::make_reverse_iterator(end());
+        } else {
+            return raw();
+        }
     }
 
     /**
@@ -318,7 +703,11 @@ public:
      * reversed internal array.
      */
     [[nodiscard]] const_reverse_iterator crend() const ENTT_NOEXCEPT {
-        return crbegin() + instances.size();
+        if constexpr(paged) {
+            return std::make_reverse_iterator(cbegin());
+        } else {
+            return crbegin() + underlying_type::size();
+        }
     }
 
     /*! @copydoc crend */
@@ -328,7 +717,11 @@ public:
 
     /*! @copydoc rend */
     [[nodiscard]] reverse_iterator rend() ENTT_NOEXCEPT {
-        return rbegin() + instances.size();
+        if constexpr(paged) {
+            return std::make_reverse_iterator(begin());
+        } else {
+            return rbegin() + underlying_type::size();
+        }
     }
 
     /**
@@ -342,7 +735,7 @@ public:
      * @return The object associated with the entity.
      */
     [[nodiscard]] const value_type & get(const entity_type entt) const {
-        return instances[underlying_type::index(entt)];
+        return *element_at(underlying_type::index(entt));
     }
 
     /*! @copydoc get */
@@ -368,15 +761,24 @@ public:
      */
     template<typename... Args>
     value_type & emplace(const entity_type entt, Args &&... args) {
-        if constexpr(std::is_aggregate_v<value_type>) {
-            instances.push_back(Type{std::forward<Args>(args)...});
-        } else {
-            instances.emplace_back(std::forward<Args>(args)...);
+        const auto pos = underlying_type::slot();
+
+        if constexpr(!paged) {
+            if(reserved <= pos) {
+                // arguments can refer to objects that are about to be relocated
+                auto instance = make(std::forward<Args>(args)...);
+                maybe_resize_packed(pos + 1u);
+                return emplace(entt, std::move(instance));
+            }
         }
 
+        maybe_resize_packed(pos + 1u);
+        auto *elem = construct_at(pos, std::forward<Args>(args)...);
+        construction_guard guard{this, pos, pos + 1u};
         // entity goes after component in case constructor throws
         underlying_type::emplace(entt);
-        return instances.back();
+        guard.owner = nullptr;
+        return *elem;
     }
 
     /**
@@ -394,9 +796,28 @@ public:
      */
     template<typename It>
     void insert(It first, It last, const value_type &value = {}) {
-        instances.insert(instances.end(), std::distance(first, last), value);
+        const auto from = underlying_type::size();
+        const auto to = from + std::distance(first, last);
+
+        if constexpr(!paged) {
+            if(reserved < to) {
+                // the value can refer to an object that is about to be relocated
+                const value_type instance = value;
+                maybe_resize_packed(to);
+                return insert(first, last, instance);
+            }
+        }
+
+        maybe_resize_packed(to);
+        construction_guard guard{this, from, from};
+
+        for(; guard.to < to; ++guard.to) {
+            construct_at(guard.to, value);
+        }
+
         // entities go after components in case constructors throw
         underlying_type::insert(first, last);
+        guard.owner = nullptr;
     }
 
     /**
@@ -414,9 +835,17 @@ public:
      */
     template<typename EIt, typename CIt>
     void insert(EIt first, EIt last, CIt from, CIt to) {
-        instances.insert(instances.end(), from, to);
+        const auto pos = underlying_type::size();
+        maybe_resize_packed(pos + std::distance(from, to));
+        construction_guard guard{this, pos, pos};
+
+        for(; from != to; ++from, ++guard.to) {
+            construct_at(guard.to, *from);
+        }
+
         // entities go after components in case constructors throw
         underlying_type::insert(first, last);
+        guard.owner = nullptr;
     }
 
     /**
@@ -458,7 +887,7 @@ public:
     void sort_n(const size_type count, Compare compare, Sort algo = Sort{}, Args &&... args) {
         if constexpr(std::is_invocable_v<Compare, const value_type &, const value_type &>) {
             underlying_type::sort_n(count, [this, compare = std::move(compare)](const auto lhs, const auto rhs) {
-                return compare(std::as_const(instances[underlying_type::index(lhs)]), std::as_const(instances[underlying_type::index(rhs)]));
+                return compare(std::as_const(*element_at(underlying_type::index(lhs))), std::as_const(*element_at(underlying_type::index(rhs))));
             }, std::move(algo), std::forward<Args>(args)...);
         } else {
             underlying_type::sort_n(count, std::move(compare), std::move(algo), std::forward<Args>(args)...);
@@ -483,7 +912,8 @@ public:
     }
 
 private:
-    std::vector<value_type> instances;
+    std::vector<value_type *> instances;
+    size_type reserved{};
 };
 
 
@@ -606,14 +1036,293 @@ struct storage_adapter_mixin: Type {
      * @return A reference to the patched instance.
      */
     template<typename... Func>
-    decltype(auto) patch(basic_registry<entity_type> &, const entity_type entity, [[maybe_unused]] Func &&... func) {
-        auto &instance = this->get(entity);
-        (std::forward<Func>(func)(instance), ...);
-        return instance;
+    decltype(auto) patch(basic_registry<entity_type> &, [[maybe_unused]] const entity_type entity, [[maybe_unused]] Func &&... func) {
+        if constexpr(!std::is_same_v<storage_category, empty_storage_tag>) {
+            auto &instance = this->get(entity);
+            (std::forward<Func>(func)(instance), ...);
+            return instance;
+        }
     }
 };
 
 
+/**
+ * @brief Mixin type to use to add change tracking support to storage types.
+ *
+ * Each element is stamped with the tick at which it was assigned to its entity
+ * and the tick at which it was last patched or replaced. Ticks are taken from
+ * the registry that issued the request and they are kept in an array parallel
+ * to the packed one.
+ *
+ * @tparam Type The type of the underlying storage.
+ */
+template<typename Type>
+class tick_storage_mixin: public Type {
+    using tick_pair = std::pair<tick_type, tick_type>;
+
+    class iterable_since final {
+        friend class tick_storage_mixin<Type>;
+
+        class iterable_since_iterator final {
+            friend class iterable_since;
+
+            iterable_since_iterator(const iterable_since &ref, const std::size_t idx) ENTT_NOEXCEPT
+                : entities{ref.entities},
+                  ticks{ref.ticks},
+                  pos{idx},
+                  last{ref.count},
+                  tick{ref.tick},
+                  member{ref.member}
+            {
+                skip();
+            }
+
+            void skip() ENTT_NOEXCEPT {
+                // tombstones leave stale ticks behind, their slots are never returned
+                for(; pos < last && (entities[pos] == null || !internal::is_tick_after(ticks[pos].*member, tick)); ++pos);
+            }
+
+        public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = typename Type::entity_type;
+            using pointer = const value_type *;
+            using reference = value_type;
+            using iterator_category = std::forward_iterator_tag;
+
+            iterable_since_iterator() ENTT_NOEXCEPT = default;
+
+            iterable_since_iterator & operator++() ENTT_NOEXCEPT {
+                return ++pos, skip(), *this;
+            }
+
+            iterable_since_iterator operator++(int) ENTT_NOEXCEPT {
+                iterable_since_iterator orig = *this;
+                return ++(*this), orig;
+            }
+
+            [[nodiscard]] reference operator*() const ENTT_NOEXCEPT {
+                return entities[pos];
+            }
+
+            [[nodiscard]] bool operator==(const iterable_since_iterator &other) const ENTT_NOEXCEPT {
+                return other.pos == pos;
+            }
+
+            [[nodiscard]] bool operator!=(const iterable_since_iterator &other) const ENTT_NOEXCEPT {
+                return !(*this == other);
+            }
+
+        private:
+            const value_type *entities;
+            const tick_pair *ticks;
+            std::size_t pos;
+            std::size_t last;
+            tick_type tick;
+            tick_type tick_pair:: *member;
+        };
+
+        iterable_since(const typename Type::entity_type *ref, const tick_pair *cticks, const std::size_t sz, const tick_type value, tick_type tick_pair:: *elem) ENTT_NOEXCEPT
+            : entities{ref},
+              ticks{cticks},
+              count{sz},
+              tick{value},
+              member{elem}
+        {}
+
+    public:
+        using iterator = iterable_since_iterator;
+
+        iterable_since() ENTT_NOEXCEPT
+            : iterable_since{nullptr, nullptr, 0u, {}, &tick_pair::first}
+        {}
+
+        [[nodiscard]] iterator begin() const ENTT_NOEXCEPT {
+            return iterator{*this, 0u};
+        }
+
+        [[nodiscard]] iterator end() const ENTT_NOEXCEPT {
+            return iterator{*this, count};
+        }
+
+    private:
+        const typename Type::entity_type *entities;
+        const tick_pair *ticks;
+        std::size_t count;
+        tick_type tick;
+        tick_type tick_pair:: *member;
+    };
+
+    void stamp(const std::size_t pos, const tick_type tick) {
+        // trailing tombstones dropped by the underlying storage leave stale ticks behind
+        ticks.resize(Type::size());
+        ticks[pos] = {tick, tick};
+    }
+
+protected:
+    /*! @copydoc basic_sparse_set::swap_at */
+    void swap_at(const std::size_t lhs, const std::size_t rhs) override {
+        // trailing tombstones can leave stale ticks behind, never the other way around
+        ENTT_ASSERT(!(ticks.size() < Type::size()));
+        Type::swap_at(lhs, rhs);
+        std::swap(ticks[lhs], ticks[rhs]);
+    }
+
+    /*! @copydoc basic_sparse_set::swap_and_pop */
+    void swap_and_pop(const std::size_t pos) override {
+        // the sparse set has already dropped the last entity, it's where the last ticks are
+        ENTT_ASSERT(ticks.size() == Type::size() + 1u);
+        Type::swap_and_pop(pos);
+        ticks[pos] = ticks[Type::size()];
+        ticks.resize(Type::size());
+    }
+
+    /*! @copydoc basic_sparse_set::move_and_pop */
+    void move_and_pop(const std::size_t from, const std::size_t to) override {
+        // the sparse set has already dropped the last entity and possibly some tombstones
+        ENTT_ASSERT(from == Type::size() && from < ticks.size());
+        Type::move_and_pop(from, to);
+        ticks[to] = ticks[from];
+        ticks.resize(Type::size());
+    }
+
+    /*! @copydoc basic_sparse_set::clear_all */
+    void clear_all() ENTT_NOEXCEPT override {
+        Type::clear_all();
+        ticks.clear();
+    }
+
+public:
+    /*! @brief Underlying value type. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+    /*! @brief Storage category. */
+    using storage_category = typename Type::storage_category;
+
+    /**
+     * @brief Returns the tick at which an element was assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results
+     * in undefined behavior.
+     *
+     * @param entity A valid entity identifier.
+     * @return The tick at which the element was assigned to the entity.
+     */
+    [[nodiscard]] tick_type added(const entity_type entity) const {
+        return ticks[this->index(entity)].first;
+    }
+
+    /**
+     * @brief Returns the tick at which an element was last changed.
+     *
+     * Elements are considered changed when they are assigned, patched or
+     * replaced. Updates made through references are ignored.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results
+     * in undefined behavior.
+     *
+     * @param entity A valid entity identifier.
+     * @return The tick at which the element was last changed.
+     */
+    [[nodiscard]] tick_type changed(const entity_type entity) const {
+        return ticks[this->index(entity)].second;
+    }
+
+    /**
+     * @brief Returns an iterable object to use to visit the entities to which
+     * an element was assigned after a given tick.
+     *
+     * The array of ticks is scanned linearly and only the matching entities
+     * are returned, in no particular order. The iterable object is invalidated
+     * as soon as the storage is modified.<br/>
+     * Ticks wrap around. A tick is considered to come after the given one if
+     * it's at most half the range of the tick type ahead of it.
+     *
+     * @param tick The tick after which an element is considered as new.
+     * @return An iterable object to use to visit the matching entities.
+     */
+    [[nodiscard]] iterable_since added_since(const tick_type tick) const ENTT_NOEXCEPT {
+        return iterable_since{this->data(), ticks.data(), this->size(), tick, &tick_pair::first};
+    }
+
+    /**
+     * @brief Returns an iterable object to use to visit the entities whose
+     * element changed after a given tick.
+     *
+     * @sa added_since
+     *
+     * @param tick The tick after which an element is considered as changed.
+     * @return An iterable object to use to visit the matching entities.
+     */
+    [[nodiscard]] iterable_since changed_since(const tick_type tick) const ENTT_NOEXCEPT {
+        return iterable_since{this->data(), ticks.data(), this->size(), tick, &tick_pair::second};
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::emplace
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param owner The registry that issued the request.
+     * @param entity A valid entity identifier.
+     * @param args Parameters to use to initialize the object.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(basic_registry<entity_type> &owner, const entity_type entity, Args &&... args) {
+        Type::emplace(owner, entity, std::forward<Args>(args)...);
+        stamp(this->index(entity), owner.current_tick());
+
+        if constexpr(!std::is_same_v<storage_category, empty_storage_tag>) {
+            return this->get(entity);
+        }
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::insert
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects
+     * associated with the entities.
+     * @param owner The registry that issued the request.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects associated with
+     * the entities.
+     */
+    template<typename It, typename... Args>
+    void insert(basic_registry<entity_type> &owner, It first, It last, Args &&... args) {
+        Type::insert(owner, first, last, std::forward<Args>(args)...);
+
+        for(const auto tick = owner.current_tick(); first != last; ++first) {
+            stamp(this->index(*first), tick);
+        }
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::patch
+     * @tparam Func Types of the function objects to invoke.
+     * @param owner The registry that issued the request.
+     * @param entity A valid entity identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(basic_registry<entity_type> &owner, const entity_type entity, [[maybe_unused]] Func &&... func) {
+        if constexpr(std::is_same_v<storage_category, empty_storage_tag>) {
+            Type::patch(owner, entity);
+            ticks[this->index(entity)].second = owner.current_tick();
+        } else {
+            Type::patch(owner, entity, std::forward<Func>(func)...);
+            ticks[this->index(entity)].second = owner.current_tick();
+            return this->get(entity);
+        }
+    }
+
+private:
+    std::vector<std::pair<tick_type, tick_type>> ticks{};
+};
+
+
 /**
  * @brief Mixin type to use to add signal support to storage types.
  * @tparam Type The type of the underlying storage.
@@ -627,6 +1336,39 @@ struct sigh_storage_mixin: Type {
     /*! @brief Storage category. */
     using storage_category = typename Type::storage_category;
 
+    /*! @brief Default constructor. */
+    sigh_storage_mixin() = default;
+
+    /**
+     * @brief Copy constructor.
+     *
+     * Listeners aren't copied, they are bound to the original storage.
+     *
+     * @param other The instance to copy from.
+     */
+    sigh_storage_mixin(const sigh_storage_mixin &other)
+        : Type{other}
+    {}
+
+    /*! @brief Default move constructor. */
+    sigh_storage_mixin(sigh_storage_mixin &&) = default;
+
+    /*! @brief Default move assignment operator. @return This storage. */
+    sigh_storage_mixin & operator=(sigh_storage_mixin &&) = default;
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * Listeners aren't copied, the storage keeps its own ones.
+     *
+     * @param other The instance to copy from.
+     * @return This storage.
+     */
+    sigh_storage_mixin & operator=(const sigh_storage_mixin &other) {
+        Type::operator=(other);
+        return *this;
+    }
+
     /**
      * @brief Returns a sink object.
      *
@@ -670,6 +1412,31 @@ struct sigh_storage_mixin: Type {
         return sink{update};
     }
 
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever new instances are created and assigned to a range of entities.
+     * <br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<entity_type> &, const entity_type *, const entity_type *);
+     * @endcode
+     *
+     * Listeners receive a contiguous span of entities once per operation. A
+     * single entity results in a span of one element. Listeners are invoked
+     * **after** the objects have been assigned to the entities and **before**
+     * the listeners connected to the per-entity sink.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_construct_range() ENTT_NOEXCEPT {
+        return sink{range_construction};
+    }
+
     /**
      * @brief Returns a sink object.
      *
@@ -692,6 +1459,31 @@ struct sigh_storage_mixin: Type {
         return sink{destruction};
     }
 
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever instances are removed from a range of entities and thus
+     * destroyed.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<entity_type> &, const entity_type *, const entity_type *);
+     * @endcode
+     *
+     * Listeners receive a contiguous span of entities once per operation. A
+     * single entity results in a span of one element. Listeners are invoked
+     * **before** the objects have been removed from the entities and **before**
+     * the listeners connected to the per-entity sink.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_destroy_range() ENTT_NOEXCEPT {
+        return sink{range_destruction};
+    }
+
     /**
      * @copybrief storage_adapter_mixin::emplace
      * @tparam Args Types of arguments to use to construct the object.
@@ -703,6 +1495,7 @@ struct sigh_storage_mixin: Type {
     template<typename... Args>
     decltype(auto) emplace(basic_registry<entity_type> &owner, const entity_type entity, Args &&... args) {
         Type::emplace(owner, entity, std::forward<Args>(args)...);
+        range_construction.publish(owner, &entity, &entity + 1u);
         construction.publish(owner, entity);
 
         if constexpr(!std::is_same_v<storage_category, empty_storage_tag>) {
@@ -725,6 +1518,16 @@ struct sigh_storage_mixin: Type {
     void insert(basic_registry<entity_type> &owner, It first, It last, Args &&... args) {
         Type::insert(owner, first, last, std::forward<Args>(args)...);
 
+        if(!range_construction.empty()) {
+            // owning groups rearrange the packed array from within their listeners
+            if constexpr(std::is_pointer_v<It> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, entity_type>) {
+                range_construction.publish(owner, first, last);
+            } else {
+                const std::vector<entity_type> range(first, last);
+                range_construction.publish(owner, range.data(), range.data() + range.size());
+            }
+        }
+
         if(!construction.empty()) {
             for(; first != last; ++first) {
                 construction.publish(owner, *first);
@@ -738,6 +1541,7 @@ struct sigh_storage_mixin: Type {
      * @param entity A valid entity identifier.
      */
     void remove(basic_registry<entity_type> &owner, const entity_type entity) {
+        range_destruction.publish(owner, &entity, &entity + 1u);
         destruction.publish(owner, entity);
         Type::remove(owner, entity);
     }
@@ -751,6 +1555,15 @@ struct sigh_storage_mixin: Type {
      */
     template<typename It>
     void remove(basic_registry<entity_type> &owner, It first, It last) {
+        if(!range_destruction.empty()) {
+            if constexpr(std::is_pointer_v<It> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, entity_type>) {
+                range_destruction.publish(owner, first, last);
+            } else {
+                const std::vector<entity_type> range(first, last);
+                range_destruction.publish(owner, range.data(), range.data() + range.size());
+            }
+        }
+
         if(!destruction.empty()) {
             for(auto it = first; it != last; ++it) {
                 destruction.publish(owner, *it);
@@ -771,6 +1584,7 @@ struct sigh_storage_mixin: Type {
     template<typename... Func>
     decltype(auto) patch(basic_registry<entity_type> &owner, const entity_type entity, [[maybe_unused]] Func &&... func) {
         if constexpr(std::is_same_v<storage_category, empty_storage_tag>) {
+            Type::patch(owner, entity);
             update.publish(owner, entity);
         } else {
             Type::patch(owner, entity, std::forward<Func>(func)...);
@@ -783,6 +1597,8 @@ private:
     sigh<void(basic_registry<entity_type> &, const entity_type)> construction{};
     sigh<void(basic_registry<entity_type> &, const entity_type)> destruction{};
     sigh<void(basic_registry<entity_type> &, const entity_type)> update{};
+    sigh<void(basic_registry<entity_type> &, const entity_type *, const entity_type *)> range_construction{};
+    sigh<void(basic_registry<entity_type> &, const entity_type *, const entity_type *)> range_destruction{};
 };
 
 
@@ -796,13 +1612,20 @@ private:
  * * If the component type is a const one, the member typedef type is the
  *   declared storage type, except it has a const-qualifier added.
  *
+ * Types for which `component_traits<Type>::track_changes` is true also get
+ * change tracking support.
+ *
  * @tparam Entity A valid entity type (see entt_traits for more details).
  * @tparam Type Type of objects assigned to the entities.
  */
 template<typename Entity, typename Type, typename = void>
 struct storage_traits {
     /*! @brief Resulting type after component-to-storage conversion. */
-    using storage_type = sigh_storage_mixin<storage_adapter_mixin<basic_storage<Entity, Type>>>;
+    using storage_type = sigh_storage_mixin<std::conditional_t<
+        component_traits<Type>::track_changes,
+        tick_storage_mixin<storage_adapter_mixin<basic_storage<Entity, Type>>>,
+        storage_adapter_mixin<basic_storage<Entity, Type>>
+    >>;
 };
 
 
@@ -10,6 +10,7 @@
 #include <type_traits>
 #include "../config/config.h"
 #include "../core/type_traits.hpp"
+#include "component.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 #include "sparse_set.hpp"
@@ -89,7 +90,9 @@ class basic_view<Entity, exclude_t<Exclude...>, Component...> final {
         [[nodiscard]] bool valid() const {
             const auto entt = *it;
 
-            return std::all_of(unchecked.cbegin(), unchecked.cend(), [entt](const basic_sparse_set<Entity> *curr) { return curr->contains(entt); })
+            // tombstones are filtered out by the other pools, if any
+            return (sizeof...(Component) != 1u || entt != null)
+                && std::all_of(unchecked.cbegin(), unchecked.cend(), [entt](const basic_sparse_set<Entity> *curr) { return curr->contains(entt); })
                 && !(std::get<const storage_type<Exclude> *>(filter)->contains(entt) || ...);
         }
 
@@ -244,40 +247,61 @@ class basic_view<Entity, exclude_t<Exclude...>, Component...> final {
     }
 
     template<typename Comp, typename Func>
-    void traverse(Func func) const {
-        if(*this) {
-            if constexpr(std::is_same_v<typename storage_type<Comp>::storage_category, empty_storage_tag>) {
-                for(const auto entt: static_cast<const basic_sparse_set<entity_type> &>(*std::get<storage_type<Comp> *>(pools))) {
-                    if(((std::is_same_v<Comp, Component> || std::get<storage_type<Component> *>(pools)->contains(entt)) && ...)
-                        && !(std::get<const storage_type<Exclude> *>(filter)->contains(entt) || ...))
-                    {
-                        if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
-                            std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
-                        } else {
-                            std::apply(func, get(entt));
-                        }
+    void traverse(Func &func, const std::size_t from, const std::size_t to) const {
+        auto &cpool = *std::get<storage_type<Comp> *>(pools);
+        const auto last = cpool.basic_sparse_set<entity_type>::begin() + to;
+
+        if constexpr(std::is_same_v<typename storage_type<Comp>::storage_category, empty_storage_tag>) {
+            for(auto first = cpool.basic_sparse_set<entity_type>::begin() + from; first != last; ++first) {
+                if(const auto entt = *first; (sizeof...(Component) != 1u || entt != null)
+                    && ((std::is_same_v<Comp, Component> || std::get<storage_type<Component> *>(pools)->contains(entt)) && ...)
+                    && !(std::get<const storage_type<Exclude> *>(filter)->contains(entt) || ...))
+                {
+                    if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                        std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
+                    } else {
+                        std::apply(func, get(entt));
                     }
                 }
-            } else {
-                auto it = std::get<storage_type<Comp> *>(pools)->begin();
-
-                for(const auto entt: static_cast<const basic_sparse_set<entity_type> &>(*std::get<storage_type<Comp> *>(pools))) {
-                    if(((std::is_same_v<Comp, Component> || std::get<storage_type<Component> *>(pools)->contains(entt)) && ...)
-                        && !(std::get<const storage_type<Exclude> *>(filter)->contains(entt) || ...))
-                    {
-                        if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
-                            std::apply(func, std::tuple_cat(std::make_tuple(entt), dispatch_get<Component>(it, entt)...));
-                        } else {
-                            std::apply(func, std::tuple_cat(dispatch_get<Component>(it, entt)...));
-                        }
+            }
+        } else {
+            auto it = cpool.begin() + from;
+
+            for(auto first = cpool.basic_sparse_set<entity_type>::begin() + from; first != last; ++first, ++it) {
+                if(const auto entt = *first; (sizeof...(Component) != 1u || entt != null)
+                    && ((std::is_same_v<Comp, Component> || std::get<storage_type<Component> *>(pools)->contains(entt)) && ...)
+                    && !(std::get<const storage_type<Exclude> *>(filter)->contains(entt) || ...))
+                {
+                    if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                        std::apply(func, std::tuple_cat(std::make_tuple(entt), dispatch_get<Component>(it, entt)...));
+                    } else {
+                        std::apply(func, std::tuple_cat(dispatch_get<Component>(it, entt)...));
                     }
-
-                    ++it;
                 }
             }
         }
     }
 
+    template<typename Comp, typename Func>
+    void traverse(Func func) const {
+        if(*this) {
+            traverse<Comp>(func, 0u, std::get<storage_type<Comp> *>(pools)->size());
+        }
+    }
+
+    template<typename Comp, typename Func, typename Exec>
+    void par_traverse(Func &func, Exec &exec, const std::size_t chunk) const {
+        ENTT_ASSERT(chunk);
+
+        if(*this) {
+            const auto length = std::get<storage_type<Comp> *>(pools)->size();
+
+            exec((length + chunk - 1u) / chunk, [this, &func, length, chunk](const size_type task) {
+                traverse<Comp>(func, task * chunk, (std::min)(length, (task + 1u) * chunk));
+            });
+        }
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
@@ -497,6 +521,40 @@ public:
         traverse<Comp>(std::move(func));
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The pool used to drive the iteration is split in chunks of contiguous
+     * elements. Chunks are then submitted as tasks to the given executor, that
+     * is a function object with a signature equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, Job job);
+     * @endcode
+     *
+     * The executor must invoke `job` once for each index in `[0, count)` and
+     * return only once all the tasks have completed (see `thread_pool` for a
+     * built-in executor).
+     *
+     * @warning
+     * The function object is invoked concurrently from multiple threads and is
+     * shared among all of them. Adding or removing components and entities
+     * during the iteration results in undefined behavior.
+     *
+     * @sa each
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @tparam Exec Type of executor.
+     * @param func A valid function object.
+     * @param exec A valid executor.
+     * @param chunk Number of elements of the driving pool per task.
+     */
+    template<typename Func, typename Exec>
+    void par_each(Func func, Exec &&exec, const size_type chunk = ENTT_PARALLEL_CHUNK) const {
+        ((std::get<storage_type<Component> *>(pools) == view ? par_traverse<Component>(func, exec, chunk) : void()), ...);
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ the view.
      *
@@ -565,6 +623,10 @@ private:
  * generated them. Therefore any change to the entities and to the components
  * made by means of the registry are immediately reflected by views.
  *
+ * @note
+ * Tombstones left in the pool of a type deleted in place are skipped during
+ * iterations. In this case, iterators are bidirectional only.
+ *
  * @warning
  * Lifetime of a view must not overcome that of the registry that generated it.
  * In any other case, attempting to use a view results in undefined behavior.
@@ -576,6 +638,74 @@ template<typename Entity, typename Component>
 class basic_view<Entity, exclude_t<>, Component> final {
     using storage_type = constness_as_t<typename storage_traits<Entity, std::remove_const_t<Component>>::storage_type, Component>;
 
+    static constexpr bool in_place = component_traits<std::remove_const_t<Component>>::in_place_delete
+        && !std::is_same_v<typename storage_type::storage_category, empty_storage_tag>;
+
+    template<typename It>
+    class view_iterator final {
+        friend class basic_view<Entity, exclude_t<>, Component>;
+
+        view_iterator(It from, It to, It curr) ENTT_NOEXCEPT
+            : first{from},
+              last{to},
+              it{curr}
+        {
+            if(it != last && *it == null) {
+                ++(*this);
+            }
+        }
+
+    public:
+        using difference_type = typename std::iterator_traits<It>::difference_type;
+        using value_type = typename std::iterator_traits<It>::value_type;
+        using pointer = typename std::iterator_traits<It>::pointer;
+        using reference = typename std::iterator_traits<It>::reference;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        view_iterator() ENTT_NOEXCEPT = default;
+
+        view_iterator & operator++() ENTT_NOEXCEPT {
+            while(++it != last && *it == null);
+            return *this;
+        }
+
+        view_iterator operator++(int) ENTT_NOEXCEPT {
+            view_iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        view_iterator & operator--() ENTT_NOEXCEPT {
+            while(--it != first && *it == null);
+            return *this;
+        }
+
+        view_iterator operator--(int) ENTT_NOEXCEPT {
+            view_iterator orig = *this;
+            return operator--(), orig;
+        }
+
+        [[nodiscard]] bool operator==(const view_iterator &other) const ENTT_NOEXCEPT {
+            return other.it == it;
+        }
+
+        [[nodiscard]] bool operator!=(const view_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        [[nodiscard]] pointer operator->() const {
+            return &*it;
+        }
+
+        [[nodiscard]] reference operator*() const {
+            return *operator->();
+        }
+
+    private:
+        It first;
+        It last;
+        It it;
+    };
+
     class iterable_view {
         friend class basic_view<Entity, exclude_t<>, Component>;
 
@@ -583,14 +713,23 @@ class basic_view<Entity, exclude_t<>, Component> final {
         class iterable_view_iterator {
             friend class iterable_view;
 
+            using entity_iterator = std::tuple_element_t<0u, std::tuple<It...>>;
+
             iterable_view_iterator() ENTT_NOEXCEPT
-                : iterable_view_iterator{It{}...}
+                : iterable_view_iterator{entity_iterator{}, It{}...}
             {}
 
             template<typename... Discard>
-            iterable_view_iterator(It... from, Discard...) ENTT_NOEXCEPT
-                : it{from...}
-            {}
+            iterable_view_iterator(entity_iterator to, It... from, Discard...) ENTT_NOEXCEPT
+                : last{to},
+                  it{from...}
+            {
+                if constexpr(in_place) {
+                    if(std::get<0>(it) != last && *std::get<0>(it) == null) {
+                        ++(*this);
+                    }
+                }
+            }
 
         public:
             using difference_type = std::ptrdiff_t;
@@ -600,7 +739,15 @@ class basic_view<Entity, exclude_t<>, Component> final {
             using iterator_category = std::input_iterator_tag;
 
             iterable_view_iterator & operator++() ENTT_NOEXCEPT {
-                return (++std::get<It>(it), ...), *this;
+                if constexpr(in_place) {
+                    do {
+                        (++std::get<It>(it), ...);
+                    } while(std::get<0>(it) != last && *std::get<0>(it) == null);
+                } else {
+                    (++std::get<It>(it), ...);
+                }
+
+                return *this;
             }
 
             iterable_view_iterator operator++(int) ENTT_NOEXCEPT {
@@ -621,6 +768,7 @@ class basic_view<Entity, exclude_t<>, Component> final {
             }
 
         private:
+            entity_iterator last;
             std::tuple<It...> it;
         };
 
@@ -641,25 +789,34 @@ class basic_view<Entity, exclude_t<>, Component> final {
         >;
 
         [[nodiscard]] iterator begin() const ENTT_NOEXCEPT {
-            return pool ? iterator{pool->basic_sparse_set<entity_type>::begin(), pool->begin()} : iterator{};
+            return pool ? iterator{pool->basic_sparse_set<entity_type>::end(), pool->basic_sparse_set<entity_type>::begin(), pool->begin()} : iterator{};
         }
 
         [[nodiscard]] iterator end() const ENTT_NOEXCEPT {
-            return pool ? iterator{pool->basic_sparse_set<entity_type>::end(), pool->end()} : iterator{};
+            return pool ? iterator{pool->basic_sparse_set<entity_type>::end(), pool->basic_sparse_set<entity_type>::end(), pool->end()} : iterator{};
         }
 
         [[nodiscard]] reverse_iterator rbegin() const ENTT_NOEXCEPT {
-            return pool ? reverse_iterator{pool->basic_sparse_set<entity_type>::rbegin(), pool->rbegin()} : reverse_iterator{};
+            return pool ? reverse_iterator{pool->basic_sparse_set<entity_type>::rend(), pool->basic_sparse_set<entity_type>::rbegin(), pool->rbegin()} : reverse_iterator{};
         }
 
         [[nodiscard]] reverse_iterator rend() const ENTT_NOEXCEPT {
-            return pool ? reverse_iterator{pool->basic_sparse_set<entity_type>::rend(), pool->rend()} : reverse_iterator{};
+            return pool ? reverse_iterator{pool->basic_sparse_set<entity_type>::rend(), pool->basic_sparse_set<entity_type>::rend(), pool->rend()} : reverse_iterator{};
         }
 
     private:
         storage_type * const pool;
     };
 
+    template<typename Iterator, typename It>
+    [[nodiscard]] static Iterator make_iterator([[maybe_unused]] It first, [[maybe_unused]] It last, It curr) ENTT_NOEXCEPT {
+        if constexpr(in_place) {
+            return Iterator{first, last, curr};
+        } else {
+            return curr;
+        }
+    }
+
 public:
     /*! @brief Type of component iterated by the view. */
     using raw_type = Component;
@@ -667,10 +824,10 @@ public:
     using entity_type = Entity;
     /*! @brief Unsigned integer type. */
     using size_type = std::size_t;
-    /*! @brief Random access iterator type. */
-    using iterator = typename basic_sparse_set<Entity>::iterator;
+    /*! @brief Random access (bidirectional for types deleted in place) iterator type. */
+    using iterator = std::conditional_t<in_place, view_iterator<typename basic_sparse_set<Entity>::iterator>, typename basic_sparse_set<Entity>::iterator>;
     /*! @brief Reversed iterator type. */
-    using reverse_iterator = typename basic_sparse_set<Entity>::reverse_iterator;
+    using reverse_iterator = std::conditional_t<in_place, view_iterator<typename basic_sparse_set<Entity>::reverse_iterator>, typename basic_sparse_set<Entity>::reverse_iterator>;
 
     /*! @brief Default constructor to use to create empty, invalid views. */
     basic_view() ENTT_NOEXCEPT
@@ -687,6 +844,10 @@ public:
 
     /**
      * @brief Returns the number of entities that have the given component.
+     *
+     * @note
+     * For types deleted in place, tombstones are counted as well.
+     *
      * @return Number of entities that have the given component.
      */
     [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
@@ -705,11 +866,13 @@ public:
      * @brief Direct access to the list of components.
      *
      * The returned pointer is such that range `[raw(), raw() + size())` is
-     * always a valid range, even if the container is empty.
+     * always a valid range, even if the container is empty.<br/>
+     * For types with a paged packed array, the returned pointer refers to the
+     * array of pages instead (see the `raw` function of the storage classes).
      *
      * @return A pointer to the array of components.
      */
-    [[nodiscard]] raw_type * raw() const ENTT_NOEXCEPT {
+    [[nodiscard]] auto raw() const ENTT_NOEXCEPT {
         return *this ? pool->raw() : nullptr;
     }
 
@@ -734,7 +897,7 @@ public:
      * @return An iterator to the first entity of the view.
      */
     [[nodiscard]] iterator begin() const ENTT_NOEXCEPT {
-        return *this ? pool->basic_sparse_set<entity_type>::begin() : iterator{};
+        return *this ? make_iterator<iterator>(pool->basic_sparse_set<entity_type>::begin(), pool->basic_sparse_set<entity_type>::end(), pool->basic_sparse_set<entity_type>::begin()) : iterator{};
     }
 
     /**
@@ -747,7 +910,7 @@ public:
      * @return An iterator to the entity following the last entity of the view.
      */
     [[nodiscard]] iterator end() const ENTT_NOEXCEPT {
-        return *this ? pool->basic_sparse_set<entity_type>::end() : iterator{};
+        return *this ? make_iterator<iterator>(pool->basic_sparse_set<entity_type>::begin(), pool->basic_sparse_set<entity_type>::end(), pool->basic_sparse_set<entity_type>::end()) : iterator{};
     }
 
     /**
@@ -759,7 +922,7 @@ public:
      * @return An iterator to the first entity of the reversed view.
      */
     [[nodiscard]] reverse_iterator rbegin() const ENTT_NOEXCEPT {
-        return *this ? pool->basic_sparse_set<entity_type>::rbegin() : reverse_iterator{};
+        return *this ? make_iterator<reverse_iterator>(pool->basic_sparse_set<entity_type>::rbegin(), pool->basic_sparse_set<entity_type>::rend(), pool->basic_sparse_set<entity_type>::rbegin()) : reverse_iterator{};
     }
 
     /**
@@ -774,7 +937,7 @@ public:
      * reversed view.
      */
     [[nodiscard]] reverse_iterator rend() const ENTT_NOEXCEPT {
-        return *this ? pool->basic_sparse_set<entity_type>::rend() : reverse_iterator{};
+        return *this ? make_iterator<reverse_iterator>(pool->basic_sparse_set<entity_type>::rbegin(), pool->basic_sparse_set<entity_type>::rend(), pool->basic_sparse_set<entity_type>::rend()) : reverse_iterator{};
     }
 
     /**
@@ -804,17 +967,22 @@ public:
      * iterator otherwise.
      */
     [[nodiscard]] iterator find(const entity_type entt) const {
-        const auto it = *this ? pool->find(entt) : end();
+        const auto it = *this ? make_iterator<iterator>(pool->basic_sparse_set<entity_type>::begin(), pool->basic_sparse_set<entity_type>::end(), pool->find(entt)) : end();
         return it != end() && *it == entt ? it : end();
     }
 
     /**
      * @brief Returns the identifier that occupies the given position.
+     *
+     * @note
+     * For types deleted in place, the returned identifier can be a tombstone,
+     * that is, the null entity.
+     *
      * @param pos Position of the element to return.
      * @return The identifier that occupies the given position.
      */
     [[nodiscard]] entity_type operator[](const size_type pos) const {
-        return begin()[pos];
+        return pool->basic_sparse_set<entity_type>::begin()[pos];
     }
 
     /**
@@ -900,6 +1068,10 @@ public:
                 for(const auto pack: each()) {
                     std::apply(func, pack);
                 }
+            } else if constexpr(in_place) {
+                for(const auto pack: each()) {
+                    func(std::get<1>(pack));
+                }
             } else {
                 if(*this) {
                     for(auto &&component: *pool) {
@@ -927,6 +1099,66 @@ public:
         return iterable_view{pool};
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The pool is split in chunks of contiguous elements that are submitted as
+     * tasks to the given executor. See the multi component view for the
+     * requirements of an executor.
+     *
+     * @warning
+     * The function object is invoked concurrently from multiple threads and is
+     * shared among all of them. Adding or removing components and entities
+     * during the iteration results in undefined behavior.
+     *
+     * @sa each
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @tparam Exec Type of executor.
+     * @param func A valid function object.
+     * @param exec A valid executor.
+     * @param chunk Number of elements per task.
+     */
+    template<typename Func, typename Exec>
+    void par_each(Func func, Exec &&exec, const size_type chunk = ENTT_PARALLEL_CHUNK) const {
+        ENTT_ASSERT(chunk);
+
+        if(*this) {
+            const auto length = pool->size();
+
+            exec((length + chunk - 1u) / chunk, [this, &func, length, chunk](const size_type task) {
+                const auto from = task * chunk;
+                auto first = pool->basic_sparse_set<entity_type>::begin() + from;
+                const auto last = pool->basic_sparse_set<entity_type>::begin() + (std::min)(length, from + chunk);
+
+                if constexpr(std::is_same_v<typename storage_type::storage_category, empty_storage_tag>) {
+                    for(; first != last; ++first) {
+                        if constexpr(std::is_invocable_v<Func>) {
+                            func();
+                        } else {
+                            func(*first);
+                        }
+                    }
+                } else {
+                    for(auto it = pool->begin() + from; first != last; ++first, ++it) {
+                        if constexpr(in_place) {
+                            if(*first == null) {
+                                continue;
+                            }
+                        }
+
+                        if constexpr(is_applicable_v<Func, decltype(*each().begin())>) {
+                            func(*first, *it);
+                        } else {
+                            func(*it);
+                        }
+                    }
+                }
+            });
+        }
+    }
+
 private:
     storage_type * const pool;
 };
@@ -6,10 +6,14 @@
 #include "core/hashed_string.hpp"
 #include "core/ident.hpp"
 #include "core/monostate.hpp"
+#include "core/thread_pool.hpp"
 #include "core/type_info.hpp"
 #include "core/type_traits.hpp"
 #include "core/utility.hpp"
+#include "entity/command_buffer.hpp"
+#include "entity/component.hpp"
 #include "entity/entity.hpp"
+#include "entity/executor.hpp"
 #include "entity/group.hpp"
 #include "entity/handle.hpp"
 #include "entity/helper.hpp"
@@ -17,6 +21,7 @@
 #include "entity/organizer.hpp"
 #include "entity/poly_storage.hpp"
 #include "entity/registry.hpp"
+#include "entity/rollback.hpp"
 #include "entity/runtime_view.hpp"
 #include "entity/snapshot.hpp"
 #include "entity/sparse_set.hpp"
@@ -43,6 +48,7 @@
 #include "resource/cache.hpp"
 #include "resource/handle.hpp"
 #include "resource/loader.hpp"
+#include "signal/concurrent_queue.hpp"
 #include "signal/delegate.hpp"
 #include "signal/dispatcher.hpp"
 #include "signal/emitter.hpp"
@@ -2,8 +2,13 @@
 #define ENTT_META_CTX_HPP
 
 
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
 #include "../core/attribute.h"
 #include "../config/config.h"
+#include "../core/fwd.hpp"
 
 
 namespace entt {
@@ -21,6 +26,96 @@ namespace internal {
 struct meta_type_node;
 
 
+template<typename Node>
+class meta_index {
+    struct entry {
+        id_type key;
+        Node *node;
+    };
+
+    [[nodiscard]] std::size_t slot(const id_type key) const ENTT_NOEXCEPT {
+        // fibonacci hashing, both sequential and hashed identifiers are spread evenly
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(key) * 11400714819323198485ull) >> 32u) & (table.size() - 1u);
+    }
+
+    void rehash(const std::size_t length) {
+        auto other = std::exchange(table, std::vector<entry>(length, entry{}));
+
+        for(auto &&curr: other) {
+            if(curr.node) {
+                auto pos = slot(curr.key);
+                for(; table[pos].node; pos = (pos + 1u) & (table.size() - 1u));
+                table[pos] = curr;
+            }
+        }
+    }
+
+public:
+    [[nodiscard]] Node * find(const id_type key) const ENTT_NOEXCEPT {
+        if(!table.empty()) {
+            for(auto pos = slot(key); table[pos].node; pos = (pos + 1u) & (table.size() - 1u)) {
+                if(table[pos].key == key) {
+                    return table[pos].node;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    void assign(const id_type key, Node *node) {
+        // load factor is kept below one half to keep probe sequences short
+        if(2u * (count + 1u) > table.size()) {
+            rehash(table.empty() ? 16u : (table.size() * 2u));
+        }
+
+        auto pos = slot(key);
+        for(; table[pos].node && table[pos].key != key; pos = (pos + 1u) & (table.size() - 1u));
+        count += !table[pos].node;
+        table[pos] = entry{key, node};
+    }
+
+    void erase(const id_type key) ENTT_NOEXCEPT {
+        if(table.empty()) {
+            return;
+        }
+
+        auto pos = slot(key);
+        for(; table[pos].node && table[pos].key != key; pos = (pos + 1u) & (table.size() - 1u));
+
+        if(table[pos].node) {
+            const auto mask = table.size() - 1u;
+            table[pos] = entry{};
+            --count;
+
+            // backward shift deletion, entries never leave their probe sequences
+            for(auto next = (pos + 1u) & mask; table[next].node; next = (next + 1u) & mask) {
+                if(((next - slot(table[next].key)) & mask) >= ((next - pos) & mask)) {
+                    table[pos] = table[next];
+                    table[next] = entry{};
+                    pos = next;
+                }
+            }
+        }
+    }
+
+    void clear() ENTT_NOEXCEPT {
+        table.clear();
+        count = {};
+    }
+
+private:
+    std::vector<entry> table{};
+    std::size_t count{};
+};
+
+
+struct meta_type_index {
+    meta_index<meta_type_node> id{};
+    meta_index<meta_type_node> info{};
+};
+
+
 struct ENTT_API meta_context {
     // we could use the lines below but VS2017 returns with an ICE if combined with ENTT_API despite the code being valid C++
     //     inline static meta_type_node *local = nullptr;
@@ -35,6 +130,16 @@ struct ENTT_API meta_context {
         static meta_type_node **chain = &local();
         return chain;
     }
+
+    [[nodiscard]] static meta_type_index & local_index() ENTT_NOEXCEPT {
+        static meta_type_index index{};
+        return index;
+    }
+
+    [[nodiscard]] static meta_type_index * & global_index() ENTT_NOEXCEPT {
+        static meta_type_index *index = &local_index();
+        return index;
+    }
 };
 
 
@@ -55,10 +160,12 @@ struct meta_ctx {
      */
     static void bind(meta_ctx other) ENTT_NOEXCEPT {
         internal::meta_context::global() = other.ctx;
+        internal::meta_context::global_index() = other.index;
     }
 
 private:
     internal::meta_type_node **ctx{&internal::meta_context::local()};
+    internal::meta_type_index *index{&internal::meta_context::local_index()};
 };
 
 
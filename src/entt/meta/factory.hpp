@@ -177,6 +177,8 @@ public:
         node->id = id;
         node->next = *internal::meta_context::global();
         *internal::meta_context::global() = node;
+        internal::meta_context::global_index()->id.assign(id, node);
+        internal::meta_context::global_index()->info.assign(node->info.hash(), node);
 
         return meta_factory<Type, Type>{&node->prop};
     }
@@ -417,6 +419,7 @@ public:
             node.id = id;
             node.next = type->data;
             type->data = &node;
+            type->data_index.assign(id, &node);
 
             return meta_factory<Type, std::integral_constant<decltype(Data), Data>>{&node.prop};
         }
@@ -464,6 +467,7 @@ public:
         node.id = id;
         node.next = type->data;
         type->data = &node;
+        type->data_index.assign(id, &node);
 
         return meta_factory<Type, std::integral_constant<decltype(Setter), Setter>, std::integral_constant<decltype(Getter), Getter>>{&node.prop};
     }
@@ -507,11 +511,14 @@ public:
 
         internal::meta_func_node **it = &type->func;
         for(; *it && (*it)->id != id; it = &(*it)->next);
+        internal::meta_func_node **head = it;
         for(; *it && (*it)->id == id && (*it)->size < node.size; it = &(*it)->next);
 
         node.id = id;
         node.next = *it;
         *it = &node;
+        // overloads are sorted by size, the index points to the first of them
+        type->func_index.assign(id, *head);
 
         return meta_factory<Type, std::integral_constant<decltype(Candidate), Candidate>>{&node.prop};
     }
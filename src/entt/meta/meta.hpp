@@ -135,6 +135,8 @@ struct meta_type_node {
     meta_data_node *data{nullptr};
     meta_func_node *func{nullptr};
     void(* dtor)(void *){nullptr};
+    meta_index<meta_data_node> data_index{};
+    meta_index<meta_func_node> func_index{};
 };
 
 
@@ -159,6 +161,26 @@ auto meta_visit(const Op &op, const Node *node)
 }
 
 
+template<auto Index, typename Op>
+auto meta_find(const id_type id, const Op &op, const meta_type_node *node)
+-> decltype((node->*Index).find(id)) {
+    // nodes with the same identifier are contiguous in their lists
+    for(auto *curr = (node->*Index).find(id); curr && curr->id == id; curr = curr->next) {
+        if(op(curr)) {
+            return curr;
+        }
+    }
+
+    for(auto *curr = node->base; curr; curr = curr->next) {
+        if(auto *ret = meta_find<Index>(id, op, curr->type()); ret) {
+            return ret;
+        }
+    }
+
+    return nullptr;
+}
+
+
 template<typename Type>
 class ENTT_API meta_node {
     static_assert(std::is_same_v<Type, std::remove_cv_t<std::remove_reference_t<Type>>>, "Invalid type");
@@ -1453,7 +1475,7 @@ public:
      * @return The data associated with the given identifier, if any.
      */
     [[nodiscard]] meta_data data(const id_type id) const {
-        return internal::meta_visit<&node_type::data>([id](const auto *curr) { return curr->id == id; }, node);
+        return internal::meta_find<&node_type::data_index>(id, [](const auto *) { return true; }, node);
     }
 
     /**
@@ -1475,7 +1497,7 @@ public:
      * @return The function associated with the given identifier, if any.
      */
     [[nodiscard]] meta_func func(const id_type id) const {
-        return internal::meta_visit<&node_type::func>([id](const auto *curr) { return curr->id == id; }, node);
+        return internal::meta_find<&node_type::func_index>(id, [](const auto *) { return true; }, node);
     }
 
     /**
@@ -1529,7 +1551,7 @@ public:
         size_type extent{sz + 1u};
         bool ambiguous{};
 
-        for(auto *it = internal::meta_visit<&node_type::func>([id, sz](const auto *curr) { return curr->id == id && curr->size == sz; }, node); it && it->id == id && it->size == sz; it = it->next) {
+        for(auto *it = internal::meta_find<&node_type::func_index>(id, [sz](const auto *curr) { return curr->size == sz; }, node); it && it->id == id && it->size == sz; it = it->next) {
             size_type direct{};
             size_type ext{};
 
@@ -1662,6 +1684,16 @@ public:
 
         if(*it) {
             *it = (*it)->next;
+
+            auto *index = internal::meta_context::global_index();
+
+            if(index->id.find(node->id) == node) {
+                index->id.erase(node->id);
+            }
+
+            if(index->info.find(node->info.hash()) == node) {
+                index->info.erase(node->info.hash());
+            }
         }
 
         const auto unregister_all = y_combinator{
@@ -1682,6 +1714,8 @@ public:
         unregister_all(&node->data, &internal::meta_data_node::prop);
         unregister_all(&node->func, &internal::meta_func_node::prop);
 
+        node->data_index.clear();
+        node->func_index.clear();
         node->id = {};
         node->ctor = node->def_ctor;
         node->dtor = nullptr;
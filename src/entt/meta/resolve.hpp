@@ -38,13 +38,7 @@ template<typename Type>
  * @return The meta type associated with the given identifier, if any.
  */
 [[nodiscard]] inline meta_type resolve(const id_type id) ENTT_NOEXCEPT {
-    for(auto *curr = *internal::meta_context::global(); curr; curr = curr->next) {
-        if(curr->id == id) {
-            return curr;
-        }
-    }
-
-    return {};
+    return internal::meta_context::global_index()->id.find(id);
 }
 
 
@@ -55,13 +49,7 @@ template<typename Type>
  * @return The meta type associated with the given type info object, if any.
  */
 [[nodiscard]] inline meta_type resolve(const type_info info) ENTT_NOEXCEPT {
-    for(auto *curr = *internal::meta_context::global(); curr; curr = curr->next) {
-        if(curr->info == info) {
-            return curr;
-        }
-    }
-
-    return {};
+    return internal::meta_context::global_index()->info.find(info.hash());
 }
 
 
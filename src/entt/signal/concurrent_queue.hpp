@@ -0,0 +1,327 @@
+#ifndef ENTT_SIGNAL_CONCURRENT_QUEUE_HPP
+#define ENTT_SIGNAL_CONCURRENT_QUEUE_HPP
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "fwd.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Multi-producer, single-consumer queue.
+ *
+ * Elements are stored in a chain of segments. Producers claim slots in the
+ * newest segment with an atomic increment and chain a larger segment with a
+ * compare-and-swap when it's full. No locks are involved and elements are never
+ * moved once constructed.<br/>
+ * The consumer visits elements in place and then destroys them. The largest
+ * segment is kept for the next round, therefore a queue doesn't allocate once
+ * it has grown to the number of elements it receives between two rounds.
+ *
+ * Only `emplace` and `insert` are thread safe. All the other member functions
+ * must not run concurrently with them. It's responsibility of the users to
+ * make all the producers _happen before_ the consumer, as an example by joining
+ * them or by waiting for them on an executor.
+ *
+ * @tparam Type Type of elements.
+ */
+template<typename Type>
+class concurrent_queue final {
+    static_assert(std::is_same_v<Type, std::decay_t<Type>>, "Invalid element type");
+
+    static constexpr std::size_t min_capacity = 64u;
+
+    struct segment {
+        segment(segment *chain, const std::size_t cap, const std::size_t used)
+            : next{used},
+              prev{chain},
+              capacity{cap},
+              instances{new std::aligned_storage_t<sizeof(Type), alignof(Type)>[cap]}
+        {}
+
+        [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT {
+            return (std::min)(next.load(std::memory_order_relaxed), capacity);
+        }
+
+        [[nodiscard]] Type * element_at(const std::size_t pos) const ENTT_NOEXCEPT {
+            return std::launder(reinterpret_cast<Type *>(&instances[pos]));
+        }
+
+        std::atomic<std::size_t> next;
+        segment *prev;
+        const std::size_t capacity;
+        std::unique_ptr<std::aligned_storage_t<sizeof(Type), alignof(Type)>[]> instances;
+    };
+
+    struct drain_guard {
+        // destroys the elements and releases or keeps the segments, even if visiting them throws
+        ~drain_guard() {
+            while(chain) {
+                for(std::size_t pos{}, last = chain->size(); pos < last; ++pos) {
+                    chain->element_at(pos)->~Type();
+                }
+
+                if(auto *curr = std::exchange(chain, chain->prev); chain) {
+                    delete curr;
+                } else {
+                    // the newest segment is also the largest one, keep it if possible
+                    segment *expected{};
+                    curr->next.store(0u, std::memory_order_relaxed);
+                    curr->prev = nullptr;
+
+                    if(!owner->head.compare_exchange_strong(expected, curr, std::memory_order_release, std::memory_order_relaxed)) {
+                        delete curr;
+                    }
+                }
+            }
+        }
+
+        concurrent_queue *owner;
+        segment *chain;
+    };
+
+    template<typename... Args>
+    [[nodiscard]] static constexpr bool is_nothrow_constructible() ENTT_NOEXCEPT {
+        if constexpr(std::is_aggregate_v<Type>) {
+            return noexcept(Type{std::declval<Args>()...});
+        } else {
+            return std::is_nothrow_constructible_v<Type, Args...>;
+        }
+    }
+
+    template<typename... Args>
+    [[nodiscard]] static Type make(Args &&... args) {
+        if constexpr(std::is_aggregate_v<Type>) {
+            return Type{std::forward<Args>(args)...};
+        } else {
+            return Type(std::forward<Args>(args)...);
+        }
+    }
+
+    template<typename... Args>
+    static void construct_at(Type *elem, Args &&... args) {
+        if constexpr(std::is_aggregate_v<Type>) {
+            new (elem) Type{std::forward<Args>(args)...};
+        } else {
+            new (elem) Type(std::forward<Args>(args)...);
+        }
+    }
+
+    [[nodiscard]] segment * grow(segment *curr, const std::size_t count) {
+        const auto cap = (std::max)({min_capacity, count, curr ? (curr->capacity * 2u) : std::size_t{}});
+        auto *candidate = new segment{curr, cap, count};
+
+        if(!head.compare_exchange_strong(curr, candidate, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            delete candidate;
+            candidate = nullptr;
+        }
+
+        return candidate;
+    }
+
+    template<typename Func>
+    void claim(Func func) {
+        for(auto *curr = head.load(std::memory_order_acquire);; curr = head.load(std::memory_order_acquire)) {
+            if(curr) {
+                if(const auto pos = curr->next.fetch_add(1u, std::memory_order_relaxed); pos < curr->capacity) {
+                    func(curr->element_at(pos));
+                    return;
+                }
+            }
+
+            if(auto *fresh = grow(curr, 1u); fresh) {
+                func(fresh->element_at(0u));
+                return;
+            }
+        }
+    }
+
+    template<typename It>
+    void claim(It first, It last) {
+        for(auto count = static_cast<std::size_t>(std::distance(first, last)); count;) {
+            auto *curr = head.load(std::memory_order_acquire);
+            std::size_t pos{};
+            std::size_t len{};
+
+            if(curr) {
+                if(pos = curr->next.fetch_add(count, std::memory_order_relaxed); pos < curr->capacity) {
+                    len = (std::min)(count, curr->capacity - pos);
+                }
+            }
+
+            if(!len) {
+                if(curr = grow(curr, count); !curr) {
+                    continue;
+                }
+
+                pos = 0u;
+                len = count;
+            }
+
+            for(count -= len; len; --len, ++pos, ++first) {
+                construct_at(curr->element_at(pos), *first);
+            }
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    concurrent_queue() = default;
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    concurrent_queue(const concurrent_queue &) = delete;
+
+    /*! @brief Destroys all the elements and releases the segments. */
+    ~concurrent_queue() {
+        clear();
+        delete head.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This queue.
+     */
+    concurrent_queue & operator=(const concurrent_queue &) = delete;
+
+    /**
+     * @brief Constructs an element at the end of a queue.
+     *
+     * This function is thread safe and lock-free.<br/>
+     * Claimed slots can't be given back. Therefore, elements that can throw
+     * while being constructed from the given arguments are constructed aside
+     * first and then moved to their slots. Their types must be nothrow move
+     * constructible.
+     *
+     * @tparam Args Types of arguments to use to construct the element.
+     * @param args Parameters to use to initialize the element.
+     */
+    template<typename... Args>
+    void emplace(Args &&... args) {
+        if constexpr(is_nothrow_constructible<Args...>()) {
+            claim([&args...](Type *elem) { construct_at(elem, std::forward<Args>(args)...); });
+        } else {
+            static_assert(std::is_nothrow_move_constructible_v<Type>, "Elements that can throw on construction must be nothrow move constructible");
+            // a slot is claimed only once the element exists, it can't be given back
+            auto instance = make(std::forward<Args>(args)...);
+            claim([&instance](Type *elem) { construct_at(elem, std::move(instance)); });
+        }
+    }
+
+    /**
+     * @brief Copies a range of elements at the end of a queue.
+     *
+     * Slots are claimed in blocks rather than one at a time, which greatly
+     * reduces contention when producers buffer elements locally.<br/>
+     * This function is thread safe and lock-free. Elements of a range are
+     * contiguous and in order, unless the range spans two segments.<br/>
+     * Elements that can throw while being copied are inserted one at a time
+     * instead, as if by `emplace`.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range.
+     * @param last An iterator past the last element of the range.
+     */
+    template<typename It>
+    void insert(It first, It last) {
+        if constexpr(is_nothrow_constructible<decltype(*first)>()) {
+            claim(first, last);
+        } else {
+            for(; first != last; ++first) {
+                emplace(*first);
+            }
+        }
+    }
+
+    /**
+     * @brief Visits and then destroys all the elements of a queue.
+     *
+     * Elements are visited in place, oldest segment first. Within a segment,
+     * elements are in the order in which their slots were claimed. Elements
+     * added by the function object are left for the next round. If the
+     * function object throws, the remaining elements are destroyed without
+     * being visited.<br/>
+     * The function object is invoked either for each element or for each
+     * segment, in which case it receives a contiguous range of elements. The
+     * signature of the function should be equivalent to one of the following:
+     *
+     * @code{.cpp}
+     * void(Type &);
+     * void(Type *, Type *);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void drain(Func func) {
+        drain_guard guard{this, nullptr};
+
+        // segments are chained from the newest one, reverse them to visit the oldest first
+        for(auto *curr = head.exchange(nullptr, std::memory_order_acquire); curr;) {
+            std::swap(curr->prev, guard.chain);
+            std::swap(curr, guard.chain);
+        }
+
+        for(auto *curr = guard.chain; curr; curr = curr->prev) {
+            if constexpr(std::is_invocable_v<Func, Type *, Type *>) {
+                // a segment kept from the previous round can be empty
+                if(const auto length = curr->size(); length) {
+                    func(curr->element_at(0u), curr->element_at(0u) + length);
+                }
+            } else {
+                for(std::size_t pos{}, last = curr->size(); pos < last; ++pos) {
+                    func(*curr->element_at(pos));
+                }
+            }
+        }
+    }
+
+    /*! @brief Destroys all the elements of a queue. */
+    void clear() ENTT_NOEXCEPT {
+        drain([](auto &&) {});
+    }
+
+    /**
+     * @brief Returns the number of elements in a queue.
+     * @return Number of elements in the queue.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        size_type sz{};
+
+        for(auto *curr = head.load(std::memory_order_acquire); curr; curr = curr->prev) {
+            sz += curr->size();
+        }
+
+        return sz;
+    }
+
+    /**
+     * @brief Checks whether a queue is empty.
+     * @return True if the queue is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return !size();
+    }
+
+private:
+    std::atomic<segment *> head{};
+};
+
+
+}
+
+
+#endif
@@ -2,6 +2,7 @@
 #define ENTT_SIGNAL_DELEGATE_HPP
 
 
+#include <new>
 #include <tuple>
 #include <cstddef>
 #include <utility>
@@ -9,6 +10,7 @@
 #include <type_traits>
 #include "../core/type_traits.hpp"
 #include "../config/config.h"
+#include "fwd.hpp"
 
 
 namespace entt {
@@ -96,6 +98,10 @@ class delegate;
  */
 template<typename Ret, typename... Args>
 class delegate<Ret(Args...)> {
+    /*! @brief Owning delegates reuse the targets of plain delegates. */
+    template<typename, std::size_t>
+    friend class owning_delegate;
+
     template<auto Candidate, std::size_t... Index>
     [[nodiscard]] auto wrap(std::index_sequence<Index...>) ENTT_NOEXCEPT {
         return [](const void *, Args... args) -> Ret {
@@ -359,6 +365,442 @@ delegate(Ret(*)(const void *, Args...), const void * = nullptr) ENTT_NOEXCEPT
 -> delegate<Ret(Args...)>;
 
 
+/**
+ * @brief Owning delegate implementation.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error unless the template parameter is a function type.
+ */
+template<typename, std::size_t>
+class owning_delegate;
+
+
+/**
+ * @brief Utility class to use to send around functions, members and closures.
+ *
+ * An owning delegate offers the same functionalities of a delegate and it's
+ * invoked in the same way, with a single indirect call. In addition, it can
+ * take ownership of arbitrary callable objects such as capturing lambdas.<br/>
+ * Callable objects are stored in an inline buffer when they fit it, don't
+ * require an alignment stricter than that of a pointer and can be moved without
+ * throwing. Otherwise, they're allocated on the heap. Trivially copyable
+ * objects are copied and relocated as raw bytes, without going through their
+ * special member functions.
+ *
+ * Callable objects must be copy constructible.
+ *
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ * @tparam Len Size of the inline buffer in bytes.
+ */
+template<typename Ret, typename... Args, std::size_t Len>
+class owning_delegate<Ret(Args...), Len> {
+    enum class operation { COPY, MOVE, DTOR };
+
+    using storage_type = std::aligned_storage_t<Len + !Len, alignof(void *)>;
+    using manager_type = void(const operation, owning_delegate &, const owning_delegate &);
+
+    template<typename Type>
+    static constexpr auto in_situ = sizeof(Type) <= Len && alignof(Type) <= alignof(storage_type) && std::is_nothrow_move_constructible_v<Type>;
+
+    template<typename Type>
+    static Ret invoke(const void *payload, Args... args) {
+        Type *curr = static_cast<Type *>(const_cast<void *>(payload));
+        return Ret(std::invoke(*curr, std::forward<Args>(args)...));
+    }
+
+    template<typename Type>
+    static void manage(const operation op, owning_delegate &to, const owning_delegate &from) {
+        Type *curr = static_cast<Type *>(const_cast<void *>(from.data));
+
+        if constexpr(in_situ<Type>) {
+            switch(op) {
+            case operation::COPY:
+                to.data = new (&to.storage) Type(std::as_const(*curr));
+                break;
+            case operation::MOVE:
+                to.data = new (&to.storage) Type(std::move(*curr));
+                curr->~Type();
+                break;
+            case operation::DTOR:
+                curr->~Type();
+                break;
+            }
+        } else {
+            switch(op) {
+            case operation::COPY:
+                to.data = new Type(std::as_const(*curr));
+                break;
+            case operation::MOVE:
+                to.data = curr;
+                break;
+            case operation::DTOR:
+                delete curr;
+                break;
+            }
+        }
+    }
+
+    void acquire(const operation op, const owning_delegate &other) {
+        fn = other.fn;
+        manager = other.manager;
+
+        if(manager) {
+            manager(op, *this, other);
+        } else if(other.data == &other.storage) {
+            // trivially copyable objects are relocated as raw bytes
+            storage = other.storage;
+            data = &storage;
+        } else {
+            data = other.data;
+        }
+    }
+
+    void bind(const delegate<Ret(Args...)> &other) ENTT_NOEXCEPT {
+        reset();
+        fn = other.fn;
+        data = other.data;
+    }
+
+public:
+    /*! @brief Function type of the contained target. */
+    using function_type = Ret(const void *, Args...);
+    /*! @brief Function type of the delegate. */
+    using type = Ret(Args...);
+    /*! @brief Return type of the delegate. */
+    using result_type = Ret;
+
+    /*! @brief Default constructor. */
+    owning_delegate() ENTT_NOEXCEPT
+        : fn{nullptr}, data{nullptr}, manager{nullptr}
+    {}
+
+    /**
+     * @brief Constructs a delegate and connects a free function or an unbound
+     * member.
+     * @tparam Candidate Function or member to connect to the delegate.
+     */
+    template<auto Candidate>
+    owning_delegate(connect_arg_t<Candidate>) ENTT_NOEXCEPT
+        : owning_delegate{}
+    {
+        connect<Candidate>();
+    }
+
+    /**
+     * @brief Constructs a delegate and connects a free function with payload or
+     * a bound member.
+     * @tparam Candidate Function or member to connect to the delegate.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid object that fits the purpose.
+     */
+    template<auto Candidate, typename Type>
+    owning_delegate(connect_arg_t<Candidate>, Type &&value_or_instance) ENTT_NOEXCEPT
+        : owning_delegate{}
+    {
+        connect<Candidate>(std::forward<Type>(value_or_instance));
+    }
+
+    /**
+     * @brief Constructs a delegate and connects an user defined function with
+     * optional payload.
+     * @param function Function to connect to the delegate.
+     * @param payload User defined arbitrary data.
+     */
+    owning_delegate(function_type *function, const void *payload = nullptr) ENTT_NOEXCEPT
+        : owning_delegate{}
+    {
+        connect(function, payload);
+    }
+
+    /**
+     * @brief Constructs a delegate and takes ownership of a callable object.
+     * @tparam Func Type of callable object.
+     * @param func A valid callable object.
+     */
+    template<typename Func, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, owning_delegate> && std::is_invocable_r_v<Ret, std::decay_t<Func> &, Args...>>>
+    owning_delegate(Func &&func)
+        : owning_delegate{}
+    {
+        connect(std::forward<Func>(func));
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other The instance to copy from.
+     */
+    owning_delegate(const owning_delegate &other)
+        : owning_delegate{}
+    {
+        acquire(operation::COPY, other);
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    owning_delegate(owning_delegate &&other) ENTT_NOEXCEPT
+        : owning_delegate{}
+    {
+        acquire(operation::MOVE, other);
+        other.fn = nullptr;
+        other.data = nullptr;
+        other.manager = nullptr;
+    }
+
+    /*! @brief Frees the connected object, if any. */
+    ~owning_delegate() {
+        reset();
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This delegate.
+     */
+    owning_delegate & operator=(const owning_delegate &other) {
+        if(this != &other) {
+            reset();
+            acquire(operation::COPY, other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This delegate.
+     */
+    owning_delegate & operator=(owning_delegate &&other) ENTT_NOEXCEPT {
+        if(this != &other) {
+            reset();
+            acquire(operation::MOVE, other);
+            other.fn = nullptr;
+            other.data = nullptr;
+            other.manager = nullptr;
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Connects a free function or an unbound member to a delegate.
+     * @tparam Candidate Function or member to connect to the delegate.
+     */
+    template<auto Candidate>
+    void connect() ENTT_NOEXCEPT {
+        bind(delegate<Ret(Args...)>{connect_arg<Candidate>});
+    }
+
+    /**
+     * @brief Connects a free function with payload or a bound member to a
+     * delegate.
+     *
+     * @sa delegate::connect(Type &)
+     *
+     * @tparam Candidate Function or member to connect to the delegate.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid reference that fits the purpose.
+     */
+    template<auto Candidate, typename Type>
+    void connect(Type &value_or_instance) ENTT_NOEXCEPT {
+        bind(delegate<Ret(Args...)>{connect_arg<Candidate>, value_or_instance});
+    }
+
+    /**
+     * @brief Connects a free function with payload or a bound member to a
+     * delegate.
+     *
+     * @sa delegate::connect(Type *)
+     *
+     * @tparam Candidate Function or member to connect to the delegate.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid pointer that fits the purpose.
+     */
+    template<auto Candidate, typename Type>
+    void connect(Type *value_or_instance) ENTT_NOEXCEPT {
+        bind(delegate<Ret(Args...)>{connect_arg<Candidate>, value_or_instance});
+    }
+
+    /**
+     * @brief Connects an user defined function with optional payload to a
+     * delegate.
+     *
+     * @sa delegate::connect(function_type *, const void *)
+     *
+     * @param function Function to connect to the delegate.
+     * @param payload User defined arbitrary data.
+     */
+    void connect(function_type *function, const void *payload = nullptr) ENTT_NOEXCEPT {
+        bind(delegate<Ret(Args...)>{function, payload});
+    }
+
+    /**
+     * @brief Takes ownership of a callable object.
+     *
+     * The object is copied or moved into the delegate and destroyed along with
+     * it. It's invoked with the arguments of the delegate, no payload is
+     * involved.
+     *
+     * @tparam Func Type of callable object.
+     * @param func A valid callable object.
+     */
+    template<typename Func>
+    std::enable_if_t<std::is_invocable_r_v<Ret, std::decay_t<Func> &, Args...>>
+    connect(Func &&func) {
+        using object_type = std::decay_t<Func>;
+        static_assert(std::is_copy_constructible_v<object_type>, "Callable objects must be copy constructible");
+
+        reset();
+
+        if constexpr(in_situ<object_type>) {
+            data = new (&storage) object_type(std::forward<Func>(func));
+        } else {
+            data = new object_type(std::forward<Func>(func));
+        }
+
+        if constexpr(!in_situ<object_type> || !std::is_trivially_copyable_v<object_type>) {
+            manager = &manage<object_type>;
+        }
+
+        fn = &invoke<object_type>;
+    }
+
+    /**
+     * @brief Resets a delegate.
+     *
+     * After a reset, a delegate cannot be invoked anymore. The connected
+     * object, if any, is destroyed.
+     */
+    void reset() ENTT_NOEXCEPT {
+        if(manager) {
+            manager(operation::DTOR, *this, *this);
+        }
+
+        fn = nullptr;
+        data = nullptr;
+        manager = nullptr;
+    }
+
+    /**
+     * @brief Returns the instance or the payload linked to a delegate, if any.
+     * @return An opaque pointer to the underlying data, a null pointer if the
+     * delegate owns a callable object.
+     */
+    [[nodiscard]] const void * instance() const ENTT_NOEXCEPT {
+        return (manager || data == &storage) ? nullptr : data;
+    }
+
+    /**
+     * @brief Returns the callable object owned by a delegate, if any.
+     * @tparam Type Type of callable object.
+     * @return A pointer to the callable object if it's of the given type, a
+     * null pointer otherwise.
+     */
+    template<typename Type>
+    [[nodiscard]] const Type * target() const ENTT_NOEXCEPT {
+        return (fn == &invoke<Type>) ? static_cast<const Type *>(data) : nullptr;
+    }
+
+    /*! @copydoc target */
+    template<typename Type>
+    [[nodiscard]] Type * target() ENTT_NOEXCEPT {
+        return const_cast<Type *>(std::as_const(*this).template target<Type>());
+    }
+
+    /**
+     * @brief Triggers a delegate.
+     *
+     * The delegate invokes the underlying function and returns the result.
+     *
+     * @warning
+     * Attempting to trigger an invalid delegate results in undefined
+     * behavior.
+     *
+     * @param args Arguments to use to invoke the underlying function.
+     * @return The value returned by the underlying function.
+     */
+    Ret operator()(Args... args) const {
+        ENTT_ASSERT(fn);
+        return fn(data, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Checks whether a delegate actually stores a listener.
+     * @return False if the delegate is empty, true otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const ENTT_NOEXCEPT {
+        // no need to test also data
+        return !(fn == nullptr);
+    }
+
+    /**
+     * @brief Compares the contents of two delegates.
+     *
+     * Callable objects owned by a delegate compare equal only to themselves.
+     * A copy of an owning delegate that holds a callable object compares
+     * unequal to the original.
+     *
+     * @param other Delegate with which to compare.
+     * @return False if the two contents differ, true otherwise.
+     */
+    [[nodiscard]] bool operator==(const owning_delegate &other) const ENTT_NOEXCEPT {
+        return fn == other.fn && data == other.data;
+    }
+
+private:
+    function_type *fn;
+    const void *data;
+    manager_type *manager;
+    storage_type storage;
+};
+
+
+/**
+ * @brief Compares the contents of two owning delegates.
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ * @tparam Len Size of the inline buffer in bytes.
+ * @param lhs A valid delegate object.
+ * @param rhs A valid delegate object.
+ * @return True if the two contents differ, false otherwise.
+ */
+template<typename Ret, typename... Args, std::size_t Len>
+[[nodiscard]] bool operator!=(const owning_delegate<Ret(Args...), Len> &lhs, const owning_delegate<Ret(Args...), Len> &rhs) ENTT_NOEXCEPT {
+    return !(lhs == rhs);
+}
+
+
+/**
+ * @brief Deduction guide.
+ * @tparam Candidate Function or member to connect to the delegate.
+ */
+template<auto Candidate>
+owning_delegate(connect_arg_t<Candidate>) ENTT_NOEXCEPT
+-> owning_delegate<std::remove_pointer_t<internal::function_pointer_t<decltype(Candidate)>>>;
+
+
+/**
+ * @brief Deduction guide.
+ * @tparam Candidate Function or member to connect to the delegate.
+ * @tparam Type Type of class or type of payload.
+ */
+template<auto Candidate, typename Type>
+owning_delegate(connect_arg_t<Candidate>, Type &&) ENTT_NOEXCEPT
+-> owning_delegate<std::remove_pointer_t<internal::function_pointer_t<decltype(Candidate), Type>>>;
+
+
+/**
+ * @brief Deduction guide.
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ */
+template<typename Ret, typename... Args>
+owning_delegate(Ret(*)(const void *, Args...), const void * = nullptr) ENTT_NOEXCEPT
+-> owning_delegate<Ret(Args...)>;
+
+
 }
 
 
@@ -10,6 +10,7 @@
 #include "../config/config.h"
 #include "../core/fwd.hpp"
 #include "../core/type_info.hpp"
+#include "concurrent_queue.hpp"
 #include "sigh.hpp"
 
 
@@ -42,33 +43,75 @@ class dispatcher {
 
         using signal_type = sigh<void(Event &)>;
         using sink_type = typename signal_type::sink_type;
+        using range_signal_type = sigh<void(Event *, Event *)>;
+        using range_sink_type = typename range_signal_type::sink_type;
+
+        struct delivery_guard {
+            // listeners can throw, the handler must accept updates again afterwards
+            ~delivery_guard() {
+                owner->frozen.clear();
+                owner->delivering = false;
+            }
 
-        void publish() override {
-            const auto length = events.size();
+            pool_handler *owner;
+        };
+
+        void deliver(Event *first, Event *last) {
+            if(!range_signal.empty()) {
+                range_signal.publish(first, last);
+            }
 
-            for(std::size_t pos{}; pos < length; ++pos) {
-                signal.publish(events[pos]);
+            if(!signal.empty()) {
+                for(; first != last; ++first) {
+                    signal.publish(*first);
+                }
             }
+        }
+
+        void publish() override {
+            // nested calls return immediately, what they would deliver is left for the next update
+            if(!delivering) {
+                delivering = true;
+                const delivery_guard guard{this};
+
+                // events enqueued during delivery land in the other buffer
+                events.swap(frozen);
+
+                if(!frozen.empty()) {
+                    deliver(frozen.data(), frozen.data() + frozen.size());
+                }
 
-            events.erase(events.cbegin(), events.cbegin()+length);
+                queue.drain([this](Event *first, Event *last) { deliver(first, last); });
+            }
         }
 
         void disconnect(void *instance) override {
             sink().disconnect(instance);
+            range_sink().disconnect(instance);
         }
 
         void clear() ENTT_NOEXCEPT override {
             events.clear();
+            queue.clear();
+
+            // listeners can clear the dispatcher while the frozen buffer is delivered, the guard clears it afterwards
+            if(!delivering) {
+                frozen.clear();
+            }
         }
 
         [[nodiscard]] sink_type sink() ENTT_NOEXCEPT {
             return entt::sink{signal};
         }
 
+        [[nodiscard]] range_sink_type range_sink() ENTT_NOEXCEPT {
+            return entt::sink{range_signal};
+        }
+
         template<typename... Args>
         void trigger(Args &&... args) {
             Event instance{std::forward<Args>(args)...};
-            signal.publish(instance);
+            deliver(&instance, &instance + 1u);
         }
 
         template<typename... Args>
@@ -80,9 +123,17 @@ class dispatcher {
             }
         }
 
+        [[nodiscard]] concurrent_queue<Event> & pending() ENTT_NOEXCEPT {
+            return queue;
+        }
+
     private:
         signal_type signal{};
+        range_signal_type range_signal{};
         std::vector<Event> events;
+        std::vector<Event> frozen;
+        concurrent_queue<Event> queue;
+        bool delivering{};
     };
 
     template<typename Event>
@@ -123,6 +174,33 @@ public:
         return assure<Event>().sink();
     }
 
+    /**
+     * @brief Returns a sink object for batches of the given event.
+     *
+     * A sink is an opaque object used to connect listeners to events.
+     *
+     * The function type for a listener is _compatible_ with:
+     * @code{.cpp}
+     * void(Event *, Event *);
+     * @endcode
+     *
+     * Listeners receive contiguous ranges of events rather than one event at a
+     * time. An update results in one range for the queued events and one for
+     * each segment of the concurrent queue, an immediate event in a range of
+     * one element. Listeners are invoked **before** the ones connected to the
+     * per-event sink.<br/>
+     * The order of invocation of the listeners isn't guaranteed.
+     *
+     * @sa sink
+     *
+     * @tparam Event Type of event of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Event>
+    [[nodiscard]] auto range_sink() {
+        return assure<Event>().range_sink();
+    }
+
     /**
      * @brief Triggers an immediate event of the given type.
      *
@@ -181,6 +259,26 @@ public:
         assure<std::decay_t<Event>>().enqueue(std::forward<Event>(event));
     }
 
+    /**
+     * @brief Returns the concurrent queue for the given event.
+     *
+     * Events pushed into the queue are delivered by the `update` member
+     * functions along with the other enqueued events, the former after the
+     * latter.<br/>
+     * The queue must be requested from the thread that owns the dispatcher. The
+     * returned reference can then be handed to other threads that push events
+     * concurrently without locks. Producers must be done before the events are
+     * delivered or discarded. Refer to the documentation of the
+     * `concurrent_queue` class for more details.
+     *
+     * @tparam Event Type of events of the queue.
+     * @return A reference to the concurrent queue for the given event.
+     */
+    template<typename Event>
+    [[nodiscard]] concurrent_queue<Event> & queue() {
+        return assure<Event>().pending();
+    }
+
     /**
      * @brief Utility function to disconnect everything related to a given value
      * or instance from a dispatcher.
@@ -211,7 +309,8 @@ public:
      * @brief Discards all the events queued so far.
      *
      * If no types are provided, the dispatcher will clear all the existing
-     * pools.
+     * pools. Events that are being delivered when a listener invokes this
+     * function are delivered anyway.
      *
      * @tparam Event Type of events to discard.
      */
@@ -233,7 +332,11 @@ public:
      *
      * This method is blocking and it doesn't return until all the events are
      * delivered to the registered listeners. It's responsibility of the users
-     * to reduce at a minimum the time spent in the bodies of the listeners.
+     * to reduce at a minimum the time spent in the bodies of the listeners.<br/>
+     * Updates for a type of event issued by its own listeners return
+     * immediately. Events enqueued in the meantime are delivered by the next
+     * update. If a listener throws, the rest of the events being delivered
+     * is discarded, either those queued or those of the concurrent queue.
      *
      * @tparam Event Type of events to send.
      */
@@ -3,10 +3,11 @@
 
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <iterator>
-#include <list>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -51,74 +52,209 @@ class emitter {
     struct pool_handler final: basic_pool {
         static_assert(std::is_same_v<Event, std::decay_t<Event>>, "Invalid event type");
 
+        static constexpr std::size_t first_page = 4u;
+
         using listener_type = std::function<void(Event &, Derived &)>;
-        using element_type = std::pair<bool, listener_type>;
-        using container_type = std::list<element_type>;
-        using connection_type = typename container_type::iterator;
+        using storage_type = std::aligned_storage_t<sizeof(void *) * 3u>;
+
+        template<typename Func>
+        static constexpr auto in_situ = sizeof(Func) <= sizeof(storage_type) && alignof(Func) <= alignof(storage_type);
+
+        struct slot_type {
+            void(* invoke)(slot_type &, Event &, Derived &){};
+            void(* destroy)(slot_type &){};
+            std::uint32_t generation{};
+            bool once{};
+            bool erased{};
+            storage_type storage;
+        };
+
+        struct connection_type {
+            slot_type *slot{};
+            std::uint32_t generation{};
+        };
+
+        template<typename Func>
+        [[nodiscard]] static Func * target(slot_type &slot) ENTT_NOEXCEPT {
+            if constexpr(in_situ<Func>) {
+                return std::launder(reinterpret_cast<Func *>(&slot.storage));
+            } else {
+                return *std::launder(reinterpret_cast<Func **>(&slot.storage));
+            }
+        }
 
-        [[nodiscard]] bool empty() const ENTT_NOEXCEPT override {
-            auto pred = [](auto &&element) { return element.first; };
+        pool_handler() = default;
+        pool_handler(const pool_handler &) = delete;
+        pool_handler & operator=(const pool_handler &) = delete;
+
+        ~pool_handler() override {
+            each([](auto &slot) {
+                if(slot.invoke) {
+                    slot.destroy(slot);
+                }
+            });
+        }
 
-            return std::all_of(once_list.cbegin(), once_list.cend(), pred) &&
-                    std::all_of(on_list.cbegin(), on_list.cend(), pred);
+        [[nodiscard]] bool empty() const ENTT_NOEXCEPT override {
+            return !count;
         }
 
         void clear() ENTT_NOEXCEPT override {
-            if(publishing) {
-                for(auto &&element: once_list) {
-                    element.first = true;
+            if(depth) {
+                each([](auto &slot) { slot.erased = (slot.invoke != nullptr); });
+                dirty = true;
+            } else {
+                each([this](auto &slot) {
+                    if(slot.invoke) {
+                        release(slot);
+                    }
+                });
+
+                // slots are handed out from the first page again
+                available.clear();
+                extent = {};
+            }
+
+            count = {};
+        }
+
+        template<typename Func>
+        connection_type connect(Func func, const bool once) {
+            static_assert(std::is_invocable_v<Func &, Event &, Derived &>, "Invalid listener type");
+            auto &slot = acquire();
+
+            if constexpr(in_situ<Func>) {
+                new (&slot.storage) Func(std::move(func));
+            } else {
+                new (&slot.storage) Func *(new Func(std::move(func)));
+            }
+
+            slot.invoke = [](slot_type &curr, Event &event, Derived &ref) {
+                (*target<Func>(curr))(event, ref);
+            };
+
+            slot.destroy = [](slot_type &curr) {
+                if constexpr(in_situ<Func>) {
+                    target<Func>(curr)->~Func();
+                } else {
+                    delete target<Func>(curr);
                 }
+            };
+
+            slot.once = once;
+            ++count;
+
+            return { &slot, slot.generation };
+        }
+
+        void erase(const connection_type conn) {
+            // stale connections find a slot with a newer generation
+            if(auto *slot = conn.slot; slot && slot->generation == conn.generation && slot->invoke && !slot->erased) {
+                --count;
 
-                for(auto &&element: on_list) {
-                    element.first = true;
+                if(depth) {
+                    slot->erased = dirty = true;
+                } else {
+                    release(*slot);
                 }
-            } else {
-                once_list.clear();
-                on_list.clear();
             }
         }
 
-        connection_type once(listener_type listener) {
-            return once_list.emplace(once_list.cend(), false, std::move(listener));
+        void publish(Event &event, Derived &ref) {
+            ++depth;
+
+            // listeners connected while publishing are never visited
+            for(std::size_t page{}, pos{}, last = extent; pos < last; ++page) {
+                auto *slots = page_at(page);
+
+                for(auto offset = pos, length = (std::min)(last, pos + (first_page << page)); offset < length; ++offset) {
+                    if(auto &slot = slots[offset - pos]; slot.invoke && !slot.erased) {
+                        if(slot.once) {
+                            slot.erased = dirty = true;
+                            --count;
+                        }
+
+                        slot.invoke(slot, event, ref);
+                    }
+                }
+
+                pos += first_page << page;
+            }
+
+            if(!--depth && dirty) {
+                each([this](auto &slot) {
+                    if(slot.erased) {
+                        release(slot);
+                    }
+                });
+
+                dirty = false;
+            }
         }
 
-        connection_type on(listener_type listener) {
-            return on_list.emplace(on_list.cend(), false, std::move(listener));
+    private:
+        [[nodiscard]] slot_type * page_at(const std::size_t page) ENTT_NOEXCEPT {
+            // the first page is part of the handler and saves an indirection
+            return page ? pages[page - 1u].get() : head;
         }
 
-        void erase(connection_type conn) {
-            conn->first = true;
+        template<typename Func>
+        void each(Func func) {
+            for(std::size_t page{}, pos{}; pos < extent; pos += (first_page << page), ++page) {
+                auto *slots = page_at(page);
 
-            if(!publishing) {
-                auto pred = [](auto &&element) { return element.first; };
-                once_list.remove_if(pred);
-                on_list.remove_if(pred);
+                for(std::size_t offset{}, length = (std::min)(extent - pos, first_page << page); offset < length; ++offset) {
+                    func(slots[offset]);
+                }
             }
         }
 
-        void publish(Event &event, Derived &ref) {
-            container_type swap_list;
-            once_list.swap(swap_list);
+        [[nodiscard]] slot_type & acquire() {
+            // slots released while publishing could be visited if reused
+            if(!depth && !available.empty()) {
+                auto *slot = available.back();
+                available.pop_back();
+                return *slot;
+            }
+
+            return slot_at(extent++);
+        }
 
-            publishing = true;
+        [[nodiscard]] slot_type & slot_at(std::size_t pos) {
+            std::size_t page{};
 
-            for(auto &&element: on_list) {
-                element.first ? void() : element.second(event, ref);
+            for(; !(pos < (first_page << page)); ++page) {
+                pos -= (first_page << page);
             }
 
-            for(auto &&element: swap_list) {
-                element.first ? void() : element.second(event, ref);
+            if(!(page < pages.size() + 1u)) {
+                pages.emplace_back(new slot_type[first_page << page]);
             }
 
-            publishing = false;
+            return page_at(page)[pos];
+        }
+
+        void release(slot_type &slot) {
+            slot.destroy(slot);
+            slot.invoke = nullptr;
+            slot.erased = false;
+            ++slot.generation;
 
-            on_list.remove_if([](auto &&element) { return element.first; });
+            // trailing slots are given back so that publishing doesn't visit them
+            if(&slot == &slot_at(extent - 1u)) {
+                --extent;
+            } else {
+                available.push_back(&slot);
+            }
         }
 
-    private:
-        bool publishing{false};
-        container_type once_list{};
-        container_type on_list{};
+        std::size_t extent{};
+        std::size_t count{};
+        std::size_t depth{};
+        bool dirty{};
+        slot_type head[first_page]{};
+        std::vector<std::unique_ptr<slot_type[]>> pages{};
+        std::vector<slot_type *> available{};
     };
 
     template<typename Event>
@@ -213,7 +349,9 @@ public:
      * to be used later to disconnect the listener if required.
      *
      * The listener is as a callable object that can be moved and the type of
-     * which is _compatible_ with `void(Event &, Derived &)`.
+     * which is _compatible_ with `void(Event &, Derived &)`. Listeners that
+     * aren't larger than three pointers are stored in place, others are
+     * allocated on the heap.
      *
      * @note
      * Whenever an event is emitted, the emitter provides the listener with a
@@ -221,12 +359,13 @@ public:
      * instances for later uses.
      *
      * @tparam Event Type of event to which to connect the listener.
+     * @tparam Func Type of listener to register.
      * @param instance The listener to register.
      * @return Connection object that can be used to disconnect the listener.
      */
-    template<typename Event>
-    connection<Event> on(listener<Event> instance) {
-        return assure<Event>()->on(std::move(instance));
+    template<typename Event, typename Func>
+    connection<Event> on(Func instance) {
+        return assure<Event>()->connect(std::move(instance), false);
     }
 
     /**
@@ -238,7 +377,9 @@ public:
      * to be used later to disconnect the listener if required.
      *
      * The listener is as a callable object that can be moved and the type of
-     * which is _compatible_ with `void(Event &, Derived &)`.
+     * which is _compatible_ with `void(Event &, Derived &)`. Listeners that
+     * aren't larger than three pointers are stored in place, others are
+     * allocated on the heap.
      *
      * @note
      * Whenever an event is emitted, the emitter provides the listener with a
@@ -246,19 +387,21 @@ public:
      * instances for later uses.
      *
      * @tparam Event Type of event to which to connect the listener.
+     * @tparam Func Type of listener to register.
      * @param instance The listener to register.
      * @return Connection object that can be used to disconnect the listener.
      */
-    template<typename Event>
-    connection<Event> once(listener<Event> instance) {
-        return assure<Event>()->once(std::move(instance));
+    template<typename Event, typename Func>
+    connection<Event> once(Func instance) {
+        return assure<Event>()->connect(std::move(instance), true);
     }
 
     /**
      * @brief Disconnects a listener from the event emitter.
      *
-     * Do not use twice the same connection to disconnect a listener, it results
-     * in undefined behavior. Once used, discard the connection object.
+     * Connections are handles to slots that are never moved. Therefore, this
+     * function runs in constant time. Connections already used and those
+     * invalidated by a call to `clear` are ignored.
      *
      * @tparam Event Type of event of the connection.
      * @param conn A valid connection.
@@ -272,7 +415,7 @@ public:
      * @brief Disconnects all the listeners for the given event type.
      *
      * All the connections previously returned for the given event are
-     * invalidated. Using them results in undefined behavior.
+     * invalidated. Using them has no effect.
      *
      * @tparam Event Type of event to reset.
      */
@@ -284,8 +427,8 @@ public:
     /**
      * @brief Disconnects all the listeners.
      *
-     * All the connections previously returned are invalidated. Using them
-     * results in undefined behavior.
+     * All the connections previously returned are invalidated. Using them has
+     * no effect.
      */
     void clear() ENTT_NOEXCEPT {
         for(auto &&cpool: pools) {
@@ -2,13 +2,24 @@
 #define ENTT_SIGNAL_FWD_HPP
 
 
+#include <cstddef>
+
+
 namespace entt {
 
 
+template<typename>
+class concurrent_queue;
+
+
 template<typename>
 class delegate;
 
 
+template<typename, std::size_t = sizeof(void *[2])>
+class owning_delegate;
+
+
 class dispatcher;
 
 
@@ -22,11 +33,11 @@ class connection;
 struct scoped_connection;
 
 
-template<typename>
+template<typename Function, typename = delegate<Function>>
 class sink;
 
 
-template<typename>
+template<typename Function, typename = delegate<Function>>
 class sigh;
 
 
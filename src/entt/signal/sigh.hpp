@@ -2,6 +2,8 @@
 #define ENTT_SIGNAL_SIGH_HPP
 
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <utility>
 #include <iterator>
@@ -16,6 +18,52 @@
 namespace entt {
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Delegate>
+struct sigh_tokens {
+    using listener_type = Delegate;
+};
+
+
+template<typename Function, std::size_t Len>
+struct sigh_tokens<owning_delegate<Function, Len>> {
+    // callable objects are tagged when connected, so that connections can find them
+    struct owned_listener: owning_delegate<Function, Len> {
+        owned_listener(owning_delegate<Function, Len> other, const std::size_t value = {})
+            : owning_delegate<Function, Len>{std::move(other)},
+              token{value}
+        {}
+
+        // tokens are kept beside the delegate, they don't take space in its inline buffer
+        std::size_t token;
+    };
+
+    using listener_type = owned_listener;
+    std::size_t next_token{};
+};
+
+
+template<typename Delegate>
+inline constexpr bool is_owning_delegate_v = !std::is_empty_v<sigh_tokens<Delegate>>;
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
 /**
  * @brief Sink class.
  *
@@ -23,8 +71,9 @@ namespace entt {
  * compile-time error unless the template parameter is a function type.
  *
  * @tparam Function A valid function type.
+ * @tparam Delegate Type of delegate used to store listeners.
  */
-template<typename Function>
+template<typename Function, typename Delegate>
 class sink;
 
 
@@ -35,8 +84,9 @@ class sink;
  * compile-time error unless the template parameter is a function type.
  *
  * @tparam Function A valid function type.
+ * @tparam Delegate Type of delegate used to store listeners.
  */
-template<typename Function>
+template<typename Function, typename Delegate>
 class sigh;
 
 
@@ -52,19 +102,25 @@ class sigh;
  * * Creating signals to use later to notify a bunch of listeners.
  * * Collecting results from a set of functions like in a voting system.
  *
+ * Listeners are stored as plain delegates by default. Signals that store them
+ * as owning delegates also accept callable objects such as capturing lambdas.
+ *
  * @tparam Ret Return type of a function type.
  * @tparam Args Types of arguments of a function type.
+ * @tparam Delegate Type of delegate used to store listeners.
  */
-template<typename Ret, typename... Args>
-class sigh<Ret(Args...)> {
+template<typename Ret, typename... Args, typename Delegate>
+class sigh<Ret(Args...), Delegate>: private internal::sigh_tokens<Delegate> {
     /*! @brief A sink is allowed to modify a signal. */
-    friend class sink<Ret(Args...)>;
+    friend class sink<Ret(Args...), Delegate>;
 
 public:
     /*! @brief Unsigned integer type. */
     using size_type = std::size_t;
+    /*! @brief Delegate type. */
+    using delegate_type = Delegate;
     /*! @brief Sink type. */
-    using sink_type = sink<Ret(Args...)>;
+    using sink_type = sink<Ret(Args...), Delegate>;
 
     /**
      * @brief Instance type when it comes to connecting member functions.
@@ -138,7 +194,7 @@ public:
     }
 
 private:
-    std::vector<delegate<Ret(Args...)>> calls;
+    std::vector<typename internal::sigh_tokens<Delegate>::listener_type> calls;
 };
 
 
@@ -151,7 +207,7 @@ private:
  */
 class connection {
     /*! @brief A sink is allowed to create connection objects. */
-    template<typename>
+    template<typename, typename>
     friend class sink;
 
     connection(delegate<void(void *)> fn, void *ref)
@@ -264,10 +320,11 @@ private:
  *
  * @tparam Ret Return type of a function type.
  * @tparam Args Types of arguments of a function type.
+ * @tparam Delegate Type of delegate used to store listeners.
  */
-template<typename Ret, typename... Args>
-class sink<Ret(Args...)> {
-    using signal_type = sigh<Ret(Args...)>;
+template<typename Ret, typename... Args, typename Delegate>
+class sink<Ret(Args...), Delegate> {
+    using signal_type = sigh<Ret(Args...), Delegate>;
     using difference_type = typename std::iterator_traits<typename decltype(signal_type::calls)::iterator>::difference_type;
 
     template<auto Candidate, typename Type>
@@ -280,12 +337,18 @@ class sink<Ret(Args...)> {
         sink{*static_cast<signal_type *>(signal)}.disconnect<Candidate>();
     }
 
+    static void release(const void *payload, void *signal) {
+        auto &calls = static_cast<signal_type *>(signal)->calls;
+        const auto token = reinterpret_cast<std::uintptr_t>(payload);
+        calls.erase(std::remove_if(calls.begin(), calls.end(), [token](const auto &call) { return call.token == token; }), calls.end());
+    }
+
 public:
     /**
      * @brief Constructs a sink that is allowed to modify a given signal.
      * @param ref A valid reference to a signal object.
      */
-    sink(sigh<Ret(Args...)> &ref) ENTT_NOEXCEPT
+    sink(sigh<Ret(Args...), Delegate> &ref) ENTT_NOEXCEPT
         : offset{},
           signal{&ref}
     {}
@@ -306,7 +369,7 @@ public:
      */
     template<auto Function>
     [[nodiscard]] sink before() {
-        delegate<Ret(Args...)> call{};
+        Delegate call{};
         call.template connect<Function>();
 
         const auto &calls = signal->calls;
@@ -327,7 +390,7 @@ public:
      */
     template<auto Candidate, typename Type>
     [[nodiscard]] sink before(Type &&value_or_instance) {
-        delegate<Ret(Args...)> call{};
+        Delegate call{};
         call.template connect<Candidate>(value_or_instance);
 
         const auto &calls = signal->calls;
@@ -396,7 +459,7 @@ public:
     connection connect() {
         disconnect<Candidate>();
 
-        delegate<Ret(Args...)> call{};
+        Delegate call{};
         call.template connect<Candidate>();
         signal->calls.insert(signal->calls.end() - offset, std::move(call));
 
@@ -426,7 +489,7 @@ public:
     connection connect(Type &&value_or_instance) {
         disconnect<Candidate>(value_or_instance);
 
-        delegate<Ret(Args...)> call{};
+        Delegate call{};
         call.template connect<Candidate>(value_or_instance);
         signal->calls.insert(signal->calls.end() - offset, std::move(call));
 
@@ -435,6 +498,36 @@ public:
         return { std::move(conn), signal };
     }
 
+    /**
+     * @brief Connects a callable object to a signal.
+     *
+     * The object is copied or moved into the signal. Therefore, this function
+     * is available only to signals that store their listeners as owning
+     * delegates.<br/>
+     * Callable objects aren't checked for multiple connections. Each of them
+     * is tagged with a token of its own, stored beside the delegate. Releasing
+     * the returned connection disconnects only the object it refers to.
+     *
+     * @tparam Func Type of callable object.
+     * @param func A valid callable object.
+     * @return A properly initialized connection object.
+     */
+    template<typename Func, typename Type = Delegate>
+    std::enable_if_t<internal::is_owning_delegate_v<Type>, connection>
+    connect(Func &&func) {
+        static_assert(std::is_invocable_r_v<Ret, std::decay_t<Func> &, Args...>, "Invalid listener type");
+        const auto token = ++signal->next_token;
+
+        Delegate call{};
+        call.connect(std::forward<Func>(func));
+        signal->calls.emplace(signal->calls.end() - offset, std::move(call), token);
+
+        delegate<void(void *)> conn{};
+        // the token travels as the payload of the connection, it's never dereferenced
+        conn.connect(&release, reinterpret_cast<const void *>(std::uintptr_t{token}));
+        return { std::move(conn), signal };
+    }
+
     /**
      * @brief Disconnects a free function or an unbound member from a signal.
      * @tparam Candidate Function or member to disconnect from the signal.
@@ -442,7 +535,7 @@ public:
     template<auto Candidate>
     void disconnect() {
         auto &calls = signal->calls;
-        delegate<Ret(Args...)> call{};
+        Delegate call{};
         call.template connect<Candidate>();
         calls.erase(std::remove(calls.begin(), calls.end(), std::move(call)), calls.end());
     }
@@ -457,7 +550,7 @@ public:
     template<auto Candidate, typename Type>
     void disconnect(Type &&value_or_instance) {
         auto &calls = signal->calls;
-        delegate<Ret(Args...)> call{};
+        Delegate call{};
         call.template connect<Candidate>(value_or_instance);
         calls.erase(std::remove(calls.begin(), calls.end(), std::move(call)), calls.end());
     }
@@ -508,9 +601,10 @@ private:
  *
  * @tparam Ret Return type of a function type.
  * @tparam Args Types of arguments of a function type.
+ * @tparam Delegate Type of delegate used to store listeners.
  */
-template<typename Ret, typename... Args>
-sink(sigh<Ret(Args...)> &) ENTT_NOEXCEPT -> sink<Ret(Args...)>;
+template<typename Ret, typename... Args, typename Delegate>
+sink(sigh<Ret(Args...), Delegate> &) ENTT_NOEXCEPT -> sink<Ret(Args...), Delegate>;
 
 
 }
@@ -1,22 +1,49 @@
+#include <algorithm>
 #include <iostream>
 #include <cstddef>
 #include <cstdint>
 #include <chrono>
+#include <functional>
 #include <iterator>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <gtest/gtest.h>
+#include <entt/core/thread_pool.hpp>
 #include <entt/core/type_info.hpp>
+#include <entt/entity/organizer.hpp>
 #include <entt/entity/registry.hpp>
+#include <entt/entity/rollback.hpp>
+#include <entt/entity/snapshot.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/emitter.hpp>
+#include <entt/signal/sigh.hpp>
 
 struct position {
     std::uint64_t x;
     std::uint64_t y;
 };
 
+struct paged_position {
+    static constexpr auto paged_packed = true;
+    std::uint64_t x;
+    std::uint64_t y;
+};
+
 struct velocity {
     std::uint64_t x;
     std::uint64_t y;
 };
 
+struct relationship {
+    entt::entity parent;
+};
+
 template<std::size_t>
 struct comp { int x; };
 
@@ -32,6 +59,26 @@ private:
     std::chrono::time_point<std::chrono::system_clock> start;
 };
 
+template<typename Type>
+void emplace_worst_case() {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+    std::chrono::duration<double> worst{};
+
+    registry.create(entities.begin(), entities.end());
+
+    timer timer;
+
+    for(const auto entity: entities) {
+        const auto start = std::chrono::system_clock::now();
+        registry.emplace<Type>(entity);
+        worst = (std::max)(worst, std::chrono::duration<double>(std::chrono::system_clock::now() - start));
+    }
+
+    timer.elapsed();
+    std::cout << worst.count() << " seconds (worst case)" << std::endl;
+}
+
 template<typename Func>
 void pathological(Func func) {
     entt::registry registry;
@@ -64,6 +111,402 @@ void pathological(Func func) {
     });
 }
 
+// the entity part of 32 bit identifiers can't address 10M entities
+enum class large_entity: std::uint64_t {};
+
+template<typename Func>
+void parallel(const std::uint64_t count, Func func) {
+    entt::basic_registry<large_entity> registry;
+    entt::thread_pool pool{};
+
+    std::cout << "Using " << pool.concurrency() << " threads" << std::endl;
+
+    for(std::uint64_t i = 0; i < count; i++) {
+        const auto entity = registry.create();
+        registry.emplace<position>(entity);
+        registry.emplace<velocity>(entity);
+    }
+
+    func(registry, pool, [](auto &... comp) {
+        ((comp.x = comp.y * comp.x + comp.y), ...);
+    });
+}
+
+void empty_system() {}
+
+template<std::size_t... Index>
+void organize(const std::size_t count, std::index_sequence<Index...>) {
+    using emplace_fn_type = void(entt::organizer &);
+    entt::organizer organizer;
+
+    emplace_fn_type *emplace[]{+[](entt::organizer &curr) {
+        curr.emplace<&empty_system, comp<Index % 8u>, const comp<8u + Index % 5u>, const comp<16u + Index % 3u>>();
+    }...};
+
+    std::cout << "Building the task graph of " << count << " systems" << std::endl;
+
+    for(std::size_t pos{}; pos < count; ++pos) {
+        emplace[pos % sizeof...(Index)](organizer);
+    }
+
+    timer timer;
+    const auto graph = organizer.graph();
+    timer.elapsed();
+
+    ASSERT_EQ(graph.size(), count);
+}
+
+template<std::size_t... Index>
+void context(std::index_sequence<Index...>) {
+    entt::registry registry;
+    const auto rounds = 10000000u / sizeof...(Index);
+    (registry.set<comp<Index>>(), ...);
+
+    std::cout << "Looking up " << sizeof...(Index) << " context variables " << rounds << " times" << std::endl;
+
+    timer timer;
+
+    for(std::size_t pos{}; pos < rounds; ++pos) {
+        ((registry.ctx<comp<Index>>().x += static_cast<int>(Index)), ...);
+    }
+
+    timer.elapsed();
+
+    ASSERT_EQ(registry.ctx<comp<sizeof...(Index) - 1u>>().x, static_cast<int>(rounds * (sizeof...(Index) - 1u)));
+}
+
+struct byte_archive {
+    void operator()(const void *data, std::size_t length) {
+        const auto *first = static_cast<const char *>(data);
+        buffer.insert(buffer.end(), first, first + length);
+    }
+
+    void operator()(void *data, std::size_t length) {
+        std::copy_n(buffer.data() + offset, length, static_cast<char *>(data));
+        offset += length;
+    }
+
+    template<typename... Value>
+    void operator()(const Value &... value) {
+        ((*this)(static_cast<const void *>(&value), sizeof(Value)), ...);
+    }
+
+    template<typename... Value>
+    void operator()(Value &... value) {
+        ((*this)(static_cast<void *>(&value), sizeof(Value)), ...);
+    }
+
+    std::vector<char> buffer{};
+    std::size_t offset{};
+};
+
+// verbatim copy of the continuous loader based on std::unordered_map, kept as a baseline
+template<typename Entity>
+class legacy_continuous_loader {
+    using traits_type = entt::entt_traits<Entity>;
+
+    void destroy(Entity entt) {
+        if(const auto it = remloc.find(entt); it == remloc.cend()) {
+            const auto local = reg->create();
+            remloc.emplace(entt, std::make_pair(local, true));
+            reg->destroy(local);
+        }
+    }
+
+    void restore(Entity entt) {
+        const auto it = remloc.find(entt);
+
+        if(it == remloc.cend()) {
+            const auto local = reg->create();
+            remloc.emplace(entt, std::make_pair(local, true));
+        } else {
+            if(!reg->valid(remloc[entt].first)) {
+                remloc[entt].first = reg->create();
+            }
+
+            // set the dirty flag
+            remloc[entt].second = true;
+        }
+    }
+
+    template<typename Container>
+    auto update(int, Container &container)
+    -> decltype(typename Container::mapped_type{}, void()) {
+        // map like container
+        Container other;
+
+        for(auto &&pair: container) {
+            using first_type = std::remove_const_t<typename std::decay_t<decltype(pair)>::first_type>;
+            using second_type = typename std::decay_t<decltype(pair)>::second_type;
+
+            if constexpr(std::is_same_v<first_type, entity_type> && std::is_same_v<second_type, entity_type>) {
+                other.emplace(map(pair.first), map(pair.second));
+            } else if constexpr(std::is_same_v<first_type, entity_type>) {
+                other.emplace(map(pair.first), std::move(pair.second));
+            } else {
+                static_assert(std::is_same_v<second_type, entity_type>, "Neither the key nor the value are of entity type");
+                other.emplace(std::move(pair.first), map(pair.second));
+            }
+        }
+
+        std::swap(container, other);
+    }
+
+    template<typename Container>
+    auto update(char, Container &container)
+    -> decltype(typename Container::value_type{}, void()) {
+        // vector like container
+        static_assert(std::is_same_v<typename Container::value_type, entity_type>, "Invalid value type");
+
+        for(auto &&entt: container) {
+            entt = map(entt);
+        }
+    }
+
+    template<typename Other, typename Type, typename Member>
+    void update([[maybe_unused]] Other &instance, [[maybe_unused]] Member Type:: *member) {
+        if constexpr(!std::is_same_v<Other, Type>) {
+            return;
+        } else if constexpr(std::is_same_v<Member, entity_type>) {
+            instance.*member = map(instance.*member);
+        } else {
+            // maybe a container? let's try...
+            update(0, instance.*member);
+        }
+    }
+
+    template<typename Component>
+    void remove_if_exists() {
+        for(auto &&ref: remloc) {
+            const auto local = ref.second.first;
+
+            if(reg->valid(local)) {
+                reg->template remove_if_exists<Component>(local);
+            }
+        }
+    }
+
+    template<typename Other, typename Archive, typename... Type, typename... Member>
+    void assign(Archive &archive, [[maybe_unused]] Member Type:: *... member) {
+        typename traits_type::entity_type length{};
+        archive(length);
+
+        entity_type entt{};
+
+        if constexpr(std::tuple_size_v<decltype(reg->template view<Other>().get({}))> == 0) {
+            while(length--) {
+                archive(entt);
+                restore(entt);
+                reg->template emplace_or_replace<Other>(map(entt));
+            }
+        } else {
+            Other instance{};
+
+            while(length--) {
+                archive(entt, instance);
+                (update(instance, member), ...);
+                restore(entt);
+                reg->template emplace_or_replace<Other>(map(entt), std::move(instance));
+            }
+        }
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+
+    /**
+     * @brief Constructs an instance that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    legacy_continuous_loader(entt::basic_registry<entity_type> &source) ENTT_NOEXCEPT
+        : reg{&source}
+    {}
+
+    /*! @brief Default move constructor. */
+    legacy_continuous_loader(legacy_continuous_loader &&) = default;
+
+    /*! @brief Default move assignment operator. @return This loader. */
+    legacy_continuous_loader & operator=(legacy_continuous_loader &&) = default;
+
+    /**
+     * @brief Restores entities that were in use during serialization.
+     *
+     * This function restores the entities that were in use during serialization
+     * and creates local counterparts for them if required.
+     *
+     * @tparam Archive Type of input archive.
+     * @param archive A valid reference to an input archive.
+     * @return A non-const reference to this loader.
+     */
+    template<typename Archive>
+    legacy_continuous_loader & entities(Archive &archive) {
+        typename traits_type::entity_type length{};
+        entity_type entt{};
+
+        archive(length);
+
+        for(decltype(length) pos{}; pos < length; ++pos) {
+            archive(entt);
+
+            if(const auto entity = (entt::to_integral(entt) & traits_type::entity_mask); entity == pos) {
+                restore(entt);
+            } else {
+                destroy(entt);
+            }
+        }
+
+        // discards the head of the list of destroyed entities
+        archive(entt);
+
+        return *this;
+    }
+
+    /**
+     * @brief Restores components and assigns them to the right entities.
+     *
+     * The template parameter list must be exactly the same used during
+     * serialization. In the event that the entity to which the component is
+     * assigned doesn't exist yet, the loader will take care to create a local
+     * counterpart for it.<br/>
+     * Members can be either data members of type entity_type or containers of
+     * entities. In both cases, the loader will visit them and update the
+     * entities by replacing each one with its local counterpart.
+     *
+     * @tparam Component Type of component to restore.
+     * @tparam Archive Type of input archive.
+     * @tparam Type Types of components to update with local counterparts.
+     * @tparam Member Types of members to update with their local counterparts.
+     * @param archive A valid reference to an input archive.
+     * @param member Members to update with their local counterparts.
+     * @return A non-const reference to this loader.
+     */
+    template<typename... Component, typename Archive, typename... Type, typename... Member>
+    legacy_continuous_loader & component(Archive &archive, Member Type:: *... member) {
+        (remove_if_exists<Component>(), ...);
+        (assign<Component>(archive, member...), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Helps to purge entities that no longer have a conterpart.
+     *
+     * Users should invoke this member function after restoring each snapshot,
+     * unless they know exactly what they are doing.
+     *
+     * @return A non-const reference to this loader.
+     */
+    legacy_continuous_loader & shrink() {
+        auto it = remloc.begin();
+
+        while(it != remloc.cend()) {
+            const auto local = it->second.first;
+            bool &dirty = it->second.second;
+
+            if(dirty) {
+                dirty = false;
+                ++it;
+            } else {
+                if(reg->valid(local)) {
+                    reg->destroy(local);
+                }
+
+                it = remloc.erase(it);
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Destroys those entities that have no components.
+     *
+     * In case all the entities were serialized but only part of the components
+     * was saved, it could happen that some of the entities have no components
+     * once restored.<br/>
+     * This functions helps to identify and destroy those entities.
+     *
+     * @return A non-const reference to this loader.
+     */
+    legacy_continuous_loader & orphans() {
+        reg->orphans([this](const auto entt) {
+            reg->destroy(entt);
+        });
+
+        return *this;
+    }
+
+    /**
+     * @brief Tests if a loader knows about a given entity.
+     * @param entt An entity identifier.
+     * @return True if `entity` is managed by the loader, false otherwise.
+     */
+    [[nodiscard]] bool contains(entity_type entt) const ENTT_NOEXCEPT {
+        return (remloc.find(entt) != remloc.cend());
+    }
+
+    /**
+     * @brief Returns the identifier to which an entity refers.
+     * @param entt An entity identifier.
+     * @return The local identifier if any, the null entity otherwise.
+     */
+    [[nodiscard]] entity_type map(entity_type entt) const ENTT_NOEXCEPT {
+        const auto it = remloc.find(entt);
+        entity_type other = entt::null;
+
+        if(it != remloc.cend()) {
+            other = it->second.first;
+        }
+
+        return other;
+    }
+
+private:
+    std::unordered_map<entity_type, std::pair<entity_type, bool>> remloc;
+    entt::basic_registry<entity_type> *reg;
+};
+
+template<typename Snapshot, typename Loader>
+void snapshot(const char *name) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+    byte_archive archive;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin(), entities.end());
+
+    std::cout << "Saving and loading 1000000 entities with components, " << name << std::endl;
+
+    timer save;
+    Snapshot{registry}.entities(archive).template component<position, velocity>(archive);
+    save.elapsed();
+
+    entt::registry other;
+
+    timer load;
+    Loader{other}.entities(archive).template component<position, velocity>(archive);
+    load.elapsed();
+
+    ASSERT_EQ(other.size<position>(), entities.size());
+    ASSERT_EQ(other.size<velocity>(), entities.size());
+}
+
+template<std::size_t>
+int variable{};
+
+template<std::size_t... Index>
+void reflect(std::index_sequence<Index...>) {
+    (entt::meta<comp<Index>>().type(static_cast<entt::id_type>(Index)), ...);
+    (entt::meta<position>().data<&variable<Index>>(static_cast<entt::id_type>(Index)), ...);
+}
+
+template<std::size_t... Index>
+void unreflect(std::index_sequence<Index...>) {
+    (entt::resolve<comp<Index>>().reset(), ...);
+    entt::resolve<position>().reset();
+}
+
 TEST(Benchmark, Create) {
     entt::registry registry;
 
@@ -120,6 +563,30 @@ TEST(Benchmark, CreateManyWithComponents) {
     timer.elapsed();
 }
 
+TEST(Benchmark, CreateManyWithComponentsOwningGroup) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+    const auto group = registry.group<position>(entt::get<velocity>);
+
+    std::cout << "Creating 1000000 entities at once with components, owning group" << std::endl;
+
+    timer timer;
+    registry.create(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin(), entities.end());
+    timer.elapsed();
+
+    ASSERT_EQ(group.size(), entities.size());
+}
+
+TEST(Benchmark, EmplaceComponentsWorstCase) {
+    std::cout << "Emplacing 1000000 components one at a time, worst case, contiguous array" << std::endl;
+    emplace_worst_case<position>();
+
+    std::cout << "Emplacing 1000000 components one at a time, worst case, paged array" << std::endl;
+    emplace_worst_case<paged_position>();
+}
+
 TEST(Benchmark, Remove) {
     entt::registry registry;
     std::vector<entt::entity> entities(1000000);
@@ -168,6 +635,24 @@ TEST(Benchmark, RemoveAll) {
     timer.elapsed();
 }
 
+TEST(Benchmark, RemoveAllOwningGroup) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+    const auto group = registry.group<position>(entt::get<velocity>);
+
+    std::cout << "Removing 1000000 components from their entities at once, owning group" << std::endl;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin(), entities.end());
+
+    timer timer;
+    registry.remove<velocity>(entities.begin(), entities.end());
+    timer.elapsed();
+
+    ASSERT_TRUE(group.empty());
+}
+
 TEST(Benchmark, Recycle) {
     entt::registry registry;
     std::vector<entt::entity> entities(1000000);
@@ -239,6 +724,60 @@ TEST(Benchmark, DestroyMany) {
     timer.elapsed();
 }
 
+TEST(Benchmark, DestroyManyOneByOne) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+
+    std::cout << "Destroying 1000000 entities, one at a time" << std::endl;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<int>(entities.begin(), entities.end());
+
+    timer timer;
+
+    for(auto entity: registry.view<int>()) {
+        registry.destroy(entity);
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, DestroyManyMultipleComponents) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+
+    std::cout << "Destroying 1000000 entities, multiple components" << std::endl;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<int>(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin() + 500000, entities.end());
+
+    timer timer;
+    registry.destroy(entities.begin(), entities.end());
+    timer.elapsed();
+}
+
+TEST(Benchmark, DestroyManyMultipleComponentsOneByOne) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+
+    std::cout << "Destroying 1000000 entities, multiple components, one at a time" << std::endl;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<int>(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin() + 500000, entities.end());
+
+    timer timer;
+
+    for(auto entity: entities) {
+        registry.destroy(entity);
+    }
+
+    timer.elapsed();
+}
+
 TEST(Benchmark, IterateSingleComponent1M) {
     entt::registry registry;
 
@@ -1062,6 +1601,66 @@ TEST(Benchmark, IterateFiveComponentsRuntime1MOne) {
     });
 }
 
+TEST(Benchmark, IterateTwoComponentsParallel1M) {
+    std::cout << "Iterating over 1000000 entities, two components, serial vs parallel" << std::endl;
+
+    parallel(1000000L, [](auto &registry, auto &pool, auto func) {
+        timer serial;
+        registry.template view<position, velocity>().each(func);
+        serial.elapsed();
+
+        timer parallel;
+        registry.template view<position, velocity>().par_each(func, pool);
+        parallel.elapsed();
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsParallel10M) {
+    std::cout << "Iterating over 10000000 entities, two components, serial vs parallel" << std::endl;
+
+    parallel(10000000L, [](auto &registry, auto &pool, auto func) {
+        timer serial;
+        registry.template view<position, velocity>().each(func);
+        serial.elapsed();
+
+        timer parallel;
+        registry.template view<position, velocity>().par_each(func, pool);
+        parallel.elapsed();
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsFullOwningGroupParallel1M) {
+    std::cout << "Iterating over 1000000 entities, two components, full owning group, serial vs parallel" << std::endl;
+
+    parallel(1000000L, [](auto &registry, auto &pool, auto func) {
+        const auto group = registry.template group<position, velocity>();
+
+        timer serial;
+        group.each(func);
+        serial.elapsed();
+
+        timer parallel;
+        group.par_each(func, pool);
+        parallel.elapsed();
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsFullOwningGroupParallel10M) {
+    std::cout << "Iterating over 10000000 entities, two components, full owning group, serial vs parallel" << std::endl;
+
+    parallel(10000000L, [](auto &registry, auto &pool, auto func) {
+        const auto group = registry.template group<position, velocity>();
+
+        timer serial;
+        group.each(func);
+        serial.elapsed();
+
+        timer parallel;
+        group.par_each(func, pool);
+        parallel.elapsed();
+    });
+}
+
 TEST(Benchmark, IteratePathological) {
     std::cout << "Pathological case" << std::endl;
 
@@ -1208,3 +1807,450 @@ TEST(Benchmark, AlmostSortedInsertionSort) {
 
     timer.elapsed();
 }
+
+TEST(Benchmark, OrganizerGraph100) {
+    organize(100u, std::make_index_sequence<32u>{});
+}
+
+TEST(Benchmark, OrganizerGraph1000) {
+    organize(1000u, std::make_index_sequence<32u>{});
+}
+
+TEST(Benchmark, OrganizerGraph5000) {
+    organize(5000u, std::make_index_sequence<32u>{});
+}
+
+TEST(Benchmark, Context1) {
+    context(std::make_index_sequence<1u>{});
+}
+
+TEST(Benchmark, Context10) {
+    context(std::make_index_sequence<10u>{});
+}
+
+TEST(Benchmark, Context100) {
+    context(std::make_index_sequence<100u>{});
+}
+
+TEST(Benchmark, MetaResolveById) {
+    reflect(std::make_index_sequence<256u>{});
+    std::size_t found{};
+
+    std::cout << "Resolving 256 meta types by identifier 1000000 times" << std::endl;
+
+    timer timer;
+
+    for(std::size_t pos{}; pos < 1000000u; ++pos) {
+        found += static_cast<bool>(entt::resolve(static_cast<entt::id_type>(pos % 256u)));
+    }
+
+    timer.elapsed();
+    unreflect(std::make_index_sequence<256u>{});
+
+    ASSERT_EQ(found, 1000000u);
+}
+
+TEST(Benchmark, MetaResolveByTypeInfo) {
+    reflect(std::make_index_sequence<256u>{});
+    const entt::type_info info[]{entt::type_id<comp<0u>>(), entt::type_id<comp<127u>>(), entt::type_id<comp<255u>>()};
+    std::size_t found{};
+
+    std::cout << "Resolving 256 meta types by type info 1000000 times" << std::endl;
+
+    timer timer;
+
+    for(std::size_t pos{}; pos < 1000000u; ++pos) {
+        found += static_cast<bool>(entt::resolve(info[pos % std::size(info)]));
+    }
+
+    timer.elapsed();
+    unreflect(std::make_index_sequence<256u>{});
+
+    ASSERT_EQ(found, 1000000u);
+}
+
+TEST(Benchmark, MetaDataById) {
+    reflect(std::make_index_sequence<256u>{});
+    const auto type = entt::resolve<position>();
+    std::size_t found{};
+
+    std::cout << "Looking up 256 meta data by identifier 1000000 times" << std::endl;
+
+    timer timer;
+
+    for(std::size_t pos{}; pos < 1000000u; ++pos) {
+        found += static_cast<bool>(type.data(static_cast<entt::id_type>(pos % 256u)));
+    }
+
+    timer.elapsed();
+    unreflect(std::make_index_sequence<256u>{});
+
+    ASSERT_EQ(found, 1000000u);
+}
+
+TEST(Benchmark, Snapshot) {
+    snapshot<entt::snapshot, entt::snapshot_loader>("per element archive");
+}
+
+TEST(Benchmark, BinarySnapshot) {
+    snapshot<entt::binary_snapshot, entt::binary_snapshot_loader>("binary archive");
+}
+
+TEST(Benchmark, Clone) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(200000);
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin(), entities.end());
+
+    std::cout << "Cloning 200000 entities with components 10 times" << std::endl;
+
+    timer timer;
+
+    for(auto pos = 0; pos < 10; ++pos) {
+        auto clone = registry.clone();
+        ASSERT_EQ(clone.size<velocity>(), entities.size());
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, Rollback) {
+    entt::registry registry;
+    entt::rollback rollback{registry, 8u};
+    std::vector<entt::entity> entities(200000);
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin(), entities.end());
+
+    std::cout << "Capturing 200000 entities with components for 64 frames, restoring every 8 frames" << std::endl;
+
+    timer timer;
+
+    for(entt::rollback::size_type frame{}; frame < 64u; ++frame) {
+        if(frame && !(frame % 8u)) {
+            rollback.restore(frame - 4u);
+        }
+
+        registry.get<position>(entities[frame]).x = frame;
+        rollback.capture(frame);
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, Dispatcher) {
+    entt::dispatcher dispatcher;
+    std::size_t received{};
+
+    struct listener {
+        void receive(position &event) {
+            ++*counter;
+
+            // every other event raises a new one during delivery
+            if(event.x % 2u) {
+                owner->enqueue<position>(event.x / 2u, event.y);
+            }
+        }
+
+        std::size_t *counter;
+        entt::dispatcher *owner;
+    } instance{&received, &dispatcher};
+
+    dispatcher.sink<position>().connect<&listener::receive>(instance);
+
+    std::cout << "Dispatching 1000000 events per frame for 10 frames" << std::endl;
+
+    timer timer;
+
+    for(auto frame = 0u; frame < 10u; ++frame) {
+        for(std::uint64_t next{}; next < 1000000u; ++next) {
+            dispatcher.enqueue<position>(next, next);
+        }
+
+        dispatcher.update<position>();
+    }
+
+    timer.elapsed();
+    dispatcher.clear();
+}
+
+TEST(Benchmark, DispatcherRange) {
+    entt::dispatcher dispatcher;
+    std::uint64_t sum{};
+
+    struct listener {
+        void receive(const position &event) { *total += event.x; }
+
+        void receive_range(const position *first, const position *last) {
+            for(; first != last; ++first) {
+                *total += first->x;
+            }
+        }
+
+        std::uint64_t *total;
+    } instance{&sum};
+
+    const auto run = [&dispatcher]() {
+        for(auto frame = 0u; frame < 10u; ++frame) {
+            for(std::uint64_t next{}; next < 1000000u; ++next) {
+                dispatcher.enqueue<position>(next, next);
+            }
+
+            dispatcher.update<position>();
+        }
+    };
+
+    std::cout << "Delivering 1000000 events per frame for 10 frames, per event and as ranges" << std::endl;
+
+    dispatcher.sink<position>().connect<&listener::receive>(instance);
+
+    timer single;
+    run();
+    single.elapsed();
+
+    dispatcher.sink<position>().disconnect(instance);
+    dispatcher.range_sink<position>().connect<&listener::receive_range>(instance);
+
+    timer range;
+    run();
+    range.elapsed();
+
+    ASSERT_EQ(sum, std::uint64_t{20u} * (std::uint64_t{999999u} * 1000000u / 2u));
+}
+
+struct session: entt::emitter<session> {};
+
+TEST(Benchmark, Emitter) {
+    std::vector<session> sessions(100000);
+    std::vector<entt::emitter<session>::connection<position>> connections(sessions.size());
+    std::uint64_t sum{};
+
+    std::cout << "Connecting, publishing to and erasing listeners of 100000 emitters" << std::endl;
+
+    timer on;
+
+    for(std::size_t pos{}; pos < sessions.size(); ++pos) {
+        connections[pos] = sessions[pos].on<position>([&sum](const position &event, session &) { sum += event.x; });
+        sessions[pos].on<position>([&sum](const position &event, session &) { sum += event.y; });
+        sessions[pos].once<position>([&sum](const position &, session &) { ++sum; });
+    }
+
+    on.elapsed();
+
+    timer publish;
+
+    for(auto round = 0u; round < 10u; ++round) {
+        for(auto &&instance: sessions) {
+            instance.publish<position>(std::uint64_t{1u}, std::uint64_t{1u});
+        }
+    }
+
+    publish.elapsed();
+
+    timer erase;
+
+    for(auto round = 0u; round < 10u; ++round) {
+        for(std::size_t pos{}; pos < sessions.size(); ++pos) {
+            sessions[pos].erase(connections[pos]);
+            connections[pos] = sessions[pos].on<position>([&sum](const position &event, session &) { sum += event.x; });
+        }
+    }
+
+    erase.elapsed();
+
+    ASSERT_EQ(sum, 2100000u);
+}
+
+TEST(Benchmark, OwningDelegate) {
+    std::vector<entt::owning_delegate<void(const position &), sizeof(void *[3])>> delegates;
+    std::vector<std::function<void(const position &)>> functions;
+    std::uint64_t sum{};
+
+    const auto run = [&sum](auto &listeners) {
+        timer construct;
+
+        for(std::uint64_t next{}; next < 1000000u; ++next) {
+            listeners.emplace_back([&sum, lhs = next % 2u, rhs = next % 3u](const position &event) { sum += event.x * lhs + event.y * rhs; });
+        }
+
+        construct.elapsed();
+
+        timer invoke;
+
+        for(auto round = 0u; round < 10u; ++round) {
+            for(auto &&listener: listeners) {
+                listener(position{1u, 1u});
+            }
+        }
+
+        invoke.elapsed();
+    };
+
+    std::cout << "Constructing and invoking 1000000 capturing listeners, owning delegate" << std::endl;
+    run(delegates);
+
+    std::cout << "Constructing and invoking 1000000 capturing listeners, std::function" << std::endl;
+    run(functions);
+
+    ASSERT_EQ(sum, 2u * 14999990u);
+}
+
+TEST(Benchmark, ConcurrentDispatcher) {
+    entt::dispatcher dispatcher;
+    std::size_t received{};
+    std::mutex mutex;
+
+    struct listener {
+        void receive(const position &) { ++*counter; }
+        std::size_t *counter;
+    } instance{&received};
+
+    dispatcher.sink<position>().connect<&listener::receive>(instance);
+
+    std::cout << "Enqueueing 500000 events from 4 threads" << std::endl;
+
+    const auto run = [](auto job) {
+        std::vector<std::thread> threads;
+
+        for(auto count = 0u; count < 4u; ++count) {
+            threads.emplace_back([&job]() {
+                for(std::uint64_t next{}; next < 125000u; ++next) {
+                    job(next);
+                }
+            });
+        }
+
+        for(auto &&thread: threads) {
+            thread.join();
+        }
+    };
+
+    timer locked;
+    run([&](std::uint64_t next) { std::lock_guard<std::mutex> lock{mutex}; dispatcher.enqueue<position>(next, next); });
+    dispatcher.update<position>();
+    locked.elapsed();
+
+    auto &queue = dispatcher.queue<position>();
+
+    timer lock_free;
+    run([&queue](std::uint64_t next) { queue.emplace(next, next); });
+    dispatcher.update<position>();
+    lock_free.elapsed();
+
+    ASSERT_EQ(received, 1000000u);
+}
+
+TEST(Benchmark, ParallelSnapshot) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+    entt::thread_pool pool{};
+    byte_archive sequential;
+    byte_archive parallel;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin(), entities.end());
+    registry.insert<comp<0>>(entities.begin(), entities.end());
+    registry.insert<comp<1>>(entities.begin(), entities.end());
+
+    std::cout << "Saving and loading 1000000 entities with 4 components, " << pool.concurrency() << " threads" << std::endl;
+
+    timer save_sequential;
+    entt::binary_snapshot{registry}.entities(sequential).component<position, velocity, comp<0>, comp<1>>(sequential);
+    save_sequential.elapsed();
+
+    timer save_parallel;
+    entt::binary_snapshot{registry}.entities(parallel).component<position, velocity, comp<0>, comp<1>>(parallel, pool);
+    save_parallel.elapsed();
+
+    entt::registry other;
+
+    timer load_sequential;
+    entt::mapped_snapshot_loader{other, sequential.buffer.data(), sequential.buffer.size()}.entities().component<position, velocity, comp<0>, comp<1>>();
+    load_sequential.elapsed();
+
+    other = {};
+
+    timer load_parallel;
+    entt::mapped_snapshot_loader{other, parallel.buffer.data(), parallel.buffer.size()}.entities().component<position, velocity, comp<0>, comp<1>>(pool);
+    load_parallel.elapsed();
+
+    ASSERT_EQ(sequential.buffer, parallel.buffer);
+    ASSERT_EQ(other.size<comp<1>>(), entities.size());
+}
+
+TEST(Benchmark, ContinuousLoader) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(100000);
+    byte_archive archive;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin(), entities.end());
+
+    for(auto entity: entities) {
+        registry.emplace<relationship>(entity, entities[(entt::to_integral(entity) + 1u) % entities.size()]);
+    }
+
+    for(auto pos = 0; pos < 10; ++pos) {
+        entt::snapshot{registry}.entities(archive).component<position, velocity, relationship>(archive);
+    }
+
+    std::cout << "Loading 100000 entities with components 10 times, legacy continuous loader" << std::endl;
+
+    entt::registry baseline;
+    legacy_continuous_loader<entt::entity> legacy{baseline};
+
+    timer reference;
+
+    for(auto pos = 0; pos < 10; ++pos) {
+        legacy.entities(archive).component<position, velocity, relationship>(archive, &relationship::parent).shrink();
+    }
+
+    reference.elapsed();
+
+    ASSERT_EQ(baseline.size<position>(), entities.size());
+    ASSERT_EQ(baseline.get<relationship>(legacy.map(entities[1u])).parent, legacy.map(entities[2u]));
+
+    std::cout << "Loading 100000 entities with components 10 times, continuous loader" << std::endl;
+
+    entt::registry other;
+    entt::continuous_loader loader{other};
+    archive.offset = {};
+
+    timer timer;
+
+    for(auto pos = 0; pos < 10; ++pos) {
+        loader.entities(archive).component<position, velocity, relationship>(archive, &relationship::parent).shrink();
+    }
+
+    timer.elapsed();
+
+    ASSERT_EQ(other.size<position>(), entities.size());
+    ASSERT_EQ(other.get<relationship>(loader.map(entities[1u])).parent, loader.map(entities[2u]));
+}
+
+TEST(Benchmark, MappedSnapshot) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+    byte_archive archive;
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin(), entities.end());
+    entt::binary_snapshot{registry}.entities(archive).component<position, velocity>(archive);
+
+    std::cout << "Loading 1000000 entities with components, mapped region" << std::endl;
+
+    entt::registry other;
+
+    timer timer;
+    entt::mapped_snapshot_loader{other, archive.buffer.data(), archive.buffer.size()}.entities().component<position, velocity>();
+    timer.elapsed();
+
+    ASSERT_EQ(other.size<position>(), entities.size());
+    ASSERT_EQ(other.size<velocity>(), entities.size());
+}
@@ -0,0 +1,70 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/thread_pool.hpp>
+
+TEST(ThreadPool, Functionalities) {
+    entt::thread_pool pool{3u};
+    std::vector<std::atomic<int>> visited(1024u);
+
+    ASSERT_EQ(pool.concurrency(), 4u);
+
+    pool(visited.size(), [&visited](const std::size_t pos) { ++visited[pos]; });
+    pool(visited.size(), [&visited](const std::size_t pos) { ++visited[pos]; });
+
+    for(auto &&value: visited) {
+        ASSERT_EQ(value, 2);
+    }
+
+    pool(0u, [](const std::size_t) { FAIL(); });
+}
+
+TEST(ThreadPool, Nested) {
+    entt::thread_pool pool{2u};
+    std::atomic<std::size_t> cnt{};
+
+    pool(8u, [&pool, &cnt](const std::size_t) {
+        pool(8u, [&cnt](const std::size_t) { ++cnt; });
+    });
+
+    ASSERT_EQ(cnt, 64u);
+}
+
+TEST(ThreadPool, NoWorkers) {
+    entt::thread_pool pool{0u};
+    std::size_t cnt{};
+
+    ASSERT_EQ(pool.concurrency(), 1u);
+
+    pool(4u, [&cnt](const std::size_t pos) { ASSERT_EQ(pos, cnt++); });
+
+    ASSERT_EQ(cnt, 4u);
+}
+
+TEST(ThreadPool, Throw) {
+    entt::thread_pool pool{1u};
+    std::atomic<std::size_t> entered{};
+
+    const auto join = [&entered]() {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{1};
+        ++entered;
+
+        // each task waits for the other one, so that both threads run a task
+        while(entered < 2u && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    };
+
+    ASSERT_THROW(pool(2u, [&join](const std::size_t) { join(); throw std::runtime_error{"task"}; }), std::runtime_error);
+    ASSERT_EQ(entered, 2u);
+
+    entered = 0u;
+    // the thread that submitted the batch still shares the next ones with the workers
+    pool(2u, [&join](const std::size_t) { join(); });
+
+    ASSERT_EQ(entered, 2u);
+}
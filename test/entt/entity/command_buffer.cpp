@@ -0,0 +1,262 @@
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/command_buffer.hpp>
+#include <entt/entity/registry.hpp>
+
+struct empty_type {};
+
+template<std::size_t>
+struct tagged_type {
+    std::size_t value;
+};
+
+template<std::size_t... Index>
+void record(entt::registry &registry, entt::command_buffer &buffer, const std::size_t pos, std::index_sequence<Index...>) {
+    (buffer.emplace<tagged_type<Index>>(buffer.create(registry), pos), ...);
+}
+
+template<std::size_t... Index>
+bool check(entt::registry &registry, std::index_sequence<Index...>) {
+    return ((registry.size<tagged_type<Index>>() == 4u) && ...);
+}
+
+struct listener {
+    void incr(const entt::registry &, entt::entity) {
+        ++counter;
+    }
+
+    std::size_t counter{};
+};
+
+TEST(CommandBuffer, Functionalities) {
+    entt::registry registry;
+    entt::command_buffer buffer;
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 42);
+    registry.emplace<char>(entity, 'c');
+
+    ASSERT_TRUE(buffer.empty());
+
+    const auto other = buffer.create(registry);
+    buffer.emplace<int>(other, 3);
+    buffer.emplace<empty_type>(other);
+    buffer.emplace<int>(entity, 99);
+    buffer.remove<char>(entity);
+
+    ASSERT_FALSE(buffer.empty());
+    ASSERT_EQ(registry.size(), 1u);
+    ASSERT_EQ(registry.get<int>(entity), 42);
+    ASSERT_TRUE(registry.has<char>(entity));
+
+    buffer.playback(registry);
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(registry.size(), 2u);
+    ASSERT_EQ(registry.get<int>(entity), 99);
+    ASSERT_FALSE(registry.has<char>(entity));
+
+    const auto created = registry.data()[1u];
+
+    ASSERT_TRUE(registry.valid(created));
+    ASSERT_EQ(registry.get<int>(created), 3);
+    ASSERT_TRUE(registry.has<empty_type>(created));
+
+    buffer.remove<int, empty_type>(created);
+    buffer.destroy(entity);
+    buffer.playback(registry);
+
+    ASSERT_FALSE(registry.valid(entity));
+    ASSERT_TRUE(registry.valid(created));
+    ASSERT_TRUE(registry.orphan(created));
+
+    const auto discarded = buffer.create(registry);
+    buffer.emplace<int>(discarded, 0);
+    buffer.destroy(created);
+    buffer.clear();
+
+    ASSERT_TRUE(buffer.empty());
+
+    buffer.playback(registry);
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_TRUE(registry.valid(created));
+    ASSERT_FALSE(registry.valid(discarded));
+    ASSERT_EQ(registry.alive(), 1u);
+}
+
+TEST(CommandBuffer, InvalidEntities) {
+    entt::registry registry;
+    entt::command_buffer buffer;
+    entt::command_buffer other;
+
+    const auto entity = registry.create();
+
+    buffer.destroy(entity);
+    other.emplace<int>(entity, 42);
+    other.emplace<char>(entity, 'c');
+    other.destroy(entity);
+
+    buffer.playback(registry);
+    other.playback(registry);
+
+    ASSERT_FALSE(registry.valid(entity));
+    ASSERT_TRUE(registry.empty<int>());
+    ASSERT_TRUE(registry.empty<char>());
+}
+
+TEST(CommandBuffer, ReservedEntities) {
+    entt::registry registry;
+    entt::command_buffer buffer;
+    entt::command_buffer other;
+    listener listener;
+
+    registry.on_construct<int>().connect<&listener::incr>(listener);
+
+    const auto entity = buffer.create(registry);
+    const auto next = buffer.create(registry);
+
+    ASSERT_NE(entity, next);
+    ASSERT_FALSE(registry.valid(entity));
+    ASSERT_FALSE(registry.valid(next));
+
+    // reserved identifiers aren't bound to the buffer that created them
+    other.emplace<int>(next, 1);
+    buffer.emplace<int>(entity, 0);
+    buffer.destroy(entity);
+    buffer.playback(registry);
+    other.playback(registry);
+
+    ASSERT_EQ(listener.counter, 2u);
+    ASSERT_EQ(registry.size(), 2u);
+    ASSERT_EQ(registry.alive(), 1u);
+    ASSERT_FALSE(registry.valid(entity));
+    ASSERT_EQ(registry.get<int>(next), 1);
+}
+
+TEST(CommandBuffer, ManyEntities) {
+    using traits_type = entt::entt_traits<entt::entity>;
+    entt::registry registry;
+    entt::command_buffer buffer;
+
+    // there is no limit to the number of entities created by a single buffer
+    for(std::size_t pos{}; pos <= traits_type::version_mask; ++pos) {
+        buffer.emplace<std::size_t>(buffer.create(registry), pos);
+    }
+
+    buffer.playback(registry);
+
+    ASSERT_EQ(registry.alive(), traits_type::version_mask + 1u);
+    ASSERT_EQ(registry.size<std::size_t>(), traits_type::version_mask + 1u);
+
+    for(auto [entity, value]: registry.view<std::size_t>().each()) {
+        ASSERT_EQ(entt::to_integral(entity), value);
+    }
+}
+
+TEST(CommandBuffer, NullEntities) {
+    using traits_type = entt::entt_traits<entt::entity>;
+    entt::registry registry;
+    entt::command_buffer buffer;
+
+    const auto entity = registry.create();
+    const auto placeholder = buffer.create(registry);
+
+    ASSERT_NE(placeholder, entt::entity{entt::null});
+
+    buffer.destroy(entt::null);
+    buffer.emplace<int>(entt::null, 42);
+    buffer.emplace<int>(entt::entity{traits_type::entity_mask | (4u << traits_type::entity_shift)}, 3);
+    buffer.remove<int>(entt::null);
+    buffer.emplace<char>(placeholder, 'c');
+    buffer.playback(registry);
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_EQ(registry.alive(), 2u);
+    ASSERT_TRUE(registry.empty<int>());
+    ASSERT_EQ(registry.size<char>(), 1u);
+}
+
+TEST(CommandBuffer, DestroyTwice) {
+    entt::registry registry;
+    entt::command_buffer buffer;
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+    const auto placeholder = buffer.create(registry);
+
+    buffer.destroy(entity);
+    buffer.destroy(placeholder);
+    buffer.destroy(entity);
+    buffer.destroy(placeholder);
+    buffer.playback(registry);
+
+    ASSERT_FALSE(registry.valid(entity));
+    ASSERT_TRUE(registry.valid(other));
+    ASSERT_EQ(registry.alive(), 1u);
+
+    const auto first = registry.create();
+    const auto second = registry.create();
+
+    ASSERT_NE(first, second);
+    ASSERT_EQ(registry.alive(), 3u);
+}
+
+TEST(CommandBuffer, Multithreading) {
+    entt::registry registry;
+    std::vector<entt::command_buffer> buffers(4u);
+    std::vector<std::thread> threads;
+
+    for(std::size_t pos{}; pos < buffers.size(); ++pos) {
+        threads.emplace_back([&registry, &buffer = buffers[pos], pos]() {
+            for(auto next = 0; next < 100; ++next) {
+                buffer.emplace<std::size_t>(buffer.create(registry), pos);
+            }
+        });
+    }
+
+    for(auto &&thread: threads) {
+        thread.join();
+    }
+
+    for(auto &&buffer: buffers) {
+        buffer.playback(registry);
+    }
+
+    std::size_t count[4u]{};
+
+    registry.view<std::size_t>().each([&count](const auto value) { ++count[value]; });
+
+    ASSERT_EQ(registry.alive(), 400u);
+    ASSERT_EQ(count[0u], 100u);
+    ASSERT_EQ(count[1u], 100u);
+    ASSERT_EQ(count[2u], 100u);
+    ASSERT_EQ(count[3u], 100u);
+}
+
+TEST(CommandBuffer, MultithreadingTypes) {
+    entt::registry registry;
+    std::vector<entt::command_buffer> buffers(4u);
+    std::vector<std::thread> threads;
+
+    for(std::size_t pos{}; pos < buffers.size(); ++pos) {
+        threads.emplace_back([&registry, &buffer = buffers[pos], pos]() {
+            // types never seen before are recorded by all threads at the same time
+            record(registry, buffer, pos, std::make_index_sequence<16u>{});
+        });
+    }
+
+    for(auto &&thread: threads) {
+        thread.join();
+    }
+
+    for(auto &&buffer: buffers) {
+        buffer.playback(registry);
+    }
+
+    ASSERT_EQ(registry.alive(), 64u);
+    ASSERT_TRUE(check(registry, std::make_index_sequence<16u>{}));
+}
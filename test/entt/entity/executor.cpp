@@ -0,0 +1,107 @@
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/executor.hpp>
+#include <entt/entity/organizer.hpp>
+#include <entt/entity/registry.hpp>
+
+struct tracker {
+    void track(const std::size_t index) {
+        order[index] = ++step;
+    }
+
+    std::atomic<std::size_t> step{};
+    std::atomic<std::size_t> order[6u]{};
+};
+
+template<std::size_t Index>
+void task(tracker &data) {
+    data.track(Index);
+}
+
+TEST(Executor, Functionalities) {
+    entt::organizer organizer;
+    entt::registry registry;
+    entt::executor executor{3u};
+    tracker data{};
+
+    organizer.emplace<&task<0u>, int>(data, "t0");
+    organizer.emplace<&task<1u>, const int>(data, "t1");
+    organizer.emplace<&task<2u>, const int>(data, "t2");
+    organizer.emplace<&task<3u>, char>(data, "t3");
+    organizer.emplace<&task<4u>, int, char>(data, "t4");
+    organizer.emplace<&task<5u>, const double>(data, "t5");
+
+    const auto graph = organizer.graph();
+
+    ASSERT_EQ(executor.concurrency(), 4u);
+
+    for(auto &&vertex: graph) {
+        vertex.prepare(registry);
+    }
+
+    for(auto frame = 0u; frame < 16u; ++frame) {
+        data.step = 0u;
+        executor.run(graph, registry);
+
+        ASSERT_EQ(data.step, graph.size());
+
+        for(std::size_t pos{}; pos < graph.size(); ++pos) {
+            for(const auto child: graph[pos].children()) {
+                ASSERT_LT(data.order[pos], data.order[child]);
+            }
+        }
+    }
+
+    executor.run({}, registry);
+}
+
+TEST(Executor, NoWorkers) {
+    entt::organizer organizer;
+    entt::registry registry;
+    entt::executor executor{0u};
+    tracker data{};
+
+    organizer.emplace<&task<0u>, int>(data);
+    organizer.emplace<&task<1u>, int>(data);
+    organizer.emplace<&task<2u>, int>(data);
+
+    const auto graph = organizer.graph();
+
+    ASSERT_EQ(executor.concurrency(), 1u);
+
+    executor.run(graph, registry);
+
+    ASSERT_EQ(data.order[0u], 1u);
+    ASSERT_EQ(data.order[1u], 2u);
+    ASSERT_EQ(data.order[2u], 3u);
+}
+
+TEST(Executor, Throw) {
+    entt::organizer organizer;
+    entt::registry registry;
+    tracker data{};
+
+    organizer.emplace<&task<0u>, int>(data, "t0");
+    organizer.emplace<int>(+[](const void *, entt::registry &) { throw std::runtime_error{"t1"}; }, nullptr, "t1");
+    organizer.emplace<&task<2u>, int>(data, "t2");
+
+    const auto graph = organizer.graph();
+
+    for(auto workers: {0u, 3u}) {
+        entt::executor executor{workers};
+        data.step = 0u;
+
+        ASSERT_THROW(executor.run(graph, registry), std::runtime_error);
+        // tasks that depend on the one that threw are skipped
+        ASSERT_EQ(data.step, 1u);
+
+        data.step = 0u;
+        data.order[2u] = 0u;
+
+        ASSERT_THROW(executor.run(graph, registry), std::runtime_error);
+        ASSERT_EQ(data.order[2u], 0u);
+    }
+}
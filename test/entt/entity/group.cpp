@@ -1,8 +1,10 @@
+#include <atomic>
 #include <utility>
 #include <iterator>
 #include <algorithm>
 #include <type_traits>
 #include <gtest/gtest.h>
+#include <entt/core/thread_pool.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/group.hpp>
 
@@ -203,6 +205,23 @@ TEST(NonOwningGroup, Each) {
     ASSERT_EQ(cnt, std::size_t{0});
 }
 
+TEST(NonOwningGroup, ParallelEach) {
+    entt::registry registry;
+    entt::thread_pool pool{2u};
+    entt::entity entities[10u];
+    auto group = registry.group(entt::get<int, char>);
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities), 1);
+    registry.insert<char>(std::begin(entities), std::begin(entities) + 7u, 'c');
+
+    std::atomic<int> sum{};
+    group.par_each([&sum](auto, int &value, char &) { sum += ++value; }, pool, 3u);
+    std::as_const(registry).group_if_exists(entt::get<const int, const char>).par_each([&sum](const int &value, const char &) { sum += value; }, pool);
+
+    ASSERT_EQ(sum, 28);
+}
+
 TEST(NonOwningGroup, Sort) {
     entt::registry registry;
     auto group = registry.group(entt::get<const int, unsigned int>);
@@ -772,6 +791,24 @@ TEST(OwningGroup, Each) {
     ASSERT_EQ(cnt, std::size_t{0});
 }
 
+TEST(OwningGroup, ParallelEach) {
+    entt::registry registry;
+    entt::thread_pool pool{2u};
+    entt::entity entities[10u];
+    auto group = registry.group<int>(entt::get<char>);
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities), 1);
+    registry.insert<char>(std::begin(entities), std::begin(entities) + 7u, 'c');
+
+    std::atomic<int> sum{};
+    group.par_each([&sum](auto, int &value, char &) { sum += ++value; }, pool, 3u);
+    std::as_const(registry).group_if_exists<const int>(entt::get<const char>).par_each([&sum](const int &value, const char &) { sum += value; }, pool);
+
+    ASSERT_EQ(sum, 28);
+    ASSERT_EQ(registry.get<int>(entities[9u]), 1);
+}
+
 TEST(OwningGroup, SortOrdered) {
     entt::registry registry;
     auto group = registry.group<boxed_int, char>();
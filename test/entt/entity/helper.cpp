@@ -5,6 +5,11 @@
 #include <entt/entity/registry.hpp>
 #include <entt/core/type_traits.hpp>
 
+struct paged_type {
+    static constexpr auto paged_packed = true;
+    int value;
+};
+
 struct clazz {
     void func(entt::registry &, entt::entity curr) { entt = curr; }
     entt::entity entt{entt::null};
@@ -56,4 +61,26 @@ TEST(Helper, ToEntity) {
 
     ASSERT_EQ(entt::to_entity(registry, registry.get<int>(other)), other);
     ASSERT_EQ(entt::to_entity(registry, registry.get<char>(other)), other);
+
+    const int value{};
+
+    ASSERT_EQ(entt::to_entity(registry, value), entt::entity{entt::null});
+
+    registry.emplace<paged_type>(other);
+
+    for(auto next = 0u; next < ENTT_PACKED_PAGE; ++next) {
+        const auto curr = registry.create();
+        registry.emplace<int>(curr);
+        registry.emplace<paged_type>(curr);
+    }
+
+    const auto last = registry.create();
+    registry.emplace<int>(last);
+    registry.emplace<paged_type>(last);
+
+    ASSERT_EQ(entt::to_entity(registry, registry.get<int>(last)), last);
+    ASSERT_EQ(entt::to_entity(registry, registry.get<int>(other)), other);
+    ASSERT_EQ(entt::to_entity(registry, registry.get<paged_type>(last)), last);
+    ASSERT_EQ(entt::to_entity(registry, registry.get<paged_type>(other)), other);
+    ASSERT_EQ(entt::to_entity(registry, paged_type{}), entt::entity{entt::null});
 }
@@ -1,9 +1,13 @@
 #include <unordered_set>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <cstdint>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/type_traits.hpp>
 #include <entt/entity/registry.hpp>
@@ -11,6 +15,26 @@
 
 struct empty_type {};
 
+struct stable_type {
+    static constexpr auto in_place_delete = true;
+    int value;
+};
+
+struct tracked_type {
+    static constexpr auto track_changes = true;
+    int value;
+};
+
+struct stable_tracked_type {
+    static constexpr auto in_place_delete = true;
+    static constexpr auto track_changes = true;
+    int value;
+};
+
+struct tracked_empty_type {
+    static constexpr auto track_changes = true;
+};
+
 struct non_default_constructible {
     non_default_constructible(int v): value{v} {}
     int value;
@@ -20,6 +44,16 @@ struct aggregate {
     int value{};
 };
 
+template<std::size_t Value>
+struct variable {
+    std::size_t value{Value};
+};
+
+template<std::size_t... Index>
+void set_variables(entt::registry &registry, std::index_sequence<Index...>) {
+    (registry.set<variable<Index>>(), ...);
+}
+
 struct listener {
     template<typename Component>
     static void sort(entt::registry &registry) {
@@ -38,8 +72,22 @@ struct listener {
         --counter;
     }
 
+    template<typename Component>
+    void incr_range(const entt::registry &, const entt::entity *from, const entt::entity *to) {
+        last = (from == to) ? last : *(to - 1);
+        counter += static_cast<int>(to - from);
+        ++spans;
+    }
+
+    template<typename Component>
+    void decr_range(const entt::registry &, const entt::entity *from, const entt::entity *to) {
+        counter -= static_cast<int>(to - from);
+        ++spans;
+    }
+
     entt::entity last{entt::null};
     int counter{0};
+    int spans{0};
 };
 
 TEST(Registry, Context) {
@@ -97,6 +145,37 @@ TEST(Registry, Context) {
     ASSERT_EQ(registry.try_ctx<float>(), nullptr);
 }
 
+TEST(Registry, ContextStableAddresses) {
+    entt::registry registry;
+    auto &value = registry.set<int>(42);
+    auto &large = registry.set<std::vector<int>>(3, 42);
+
+    // forces new pages into the context
+    set_variables(registry, std::make_index_sequence<100u>{});
+    registry.unset<variable<42u>>();
+
+    ASSERT_EQ(&registry.ctx<int>(), &value);
+    ASSERT_EQ(&registry.ctx<std::vector<int>>(), &large);
+    ASSERT_EQ(registry.ctx<int>(), 42);
+    ASSERT_EQ(registry.ctx<std::vector<int>>().size(), 2u);
+    ASSERT_EQ(registry.ctx<variable<99u>>().value, 99u);
+    ASSERT_EQ(registry.try_ctx<variable<42u>>(), nullptr);
+
+    entt::registry other{std::move(registry)};
+    auto count = 0;
+
+    other.ctx([&count](auto) { ++count; });
+
+    ASSERT_EQ(count, 101);
+    ASSERT_EQ(&other.ctx<int>(), &value);
+    ASSERT_EQ(other.ctx<std::vector<int>>()[1u], 42);
+
+    other.unset<std::vector<int>>();
+
+    ASSERT_EQ(other.try_ctx<std::vector<int>>(), nullptr);
+    ASSERT_EQ(other.try_ctx<int>(), &value);
+}
+
 TEST(Registry, Functionalities) {
     entt::registry registry;
 
@@ -358,6 +437,88 @@ TEST(Registry, CreateManyEntitiesAtOnceWithListener) {
     ASSERT_EQ(listener.counter, 6);
 }
 
+TEST(Registry, ReserveEntities) {
+    entt::registry registry;
+    entt::entity entities[3];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.destroy(entities[1u]);
+    registry.destroy(entities[2u]);
+
+    const auto entity = registry.reserve_entity();
+    entt::entity other[3];
+    registry.reserve_entities(std::begin(other), std::end(other));
+
+    ASSERT_EQ(registry.size(), 3u);
+    ASSERT_EQ(registry.alive(), 1u);
+    ASSERT_FALSE(registry.valid(entity));
+    ASSERT_FALSE(registry.valid(other[0u]));
+    ASSERT_FALSE(registry.valid(other[1u]));
+    ASSERT_FALSE(registry.valid(other[2u]));
+
+    ASSERT_EQ(registry.entity(entity), registry.entity(entities[2u]));
+    ASSERT_EQ(registry.version(entity), registry.version(entities[2u]) + 1u);
+    ASSERT_EQ(registry.entity(other[0u]), registry.entity(entities[1u]));
+    ASSERT_EQ(registry.version(other[0u]), registry.version(entities[1u]) + 1u);
+    ASSERT_EQ(other[1u], entt::entity{3});
+    ASSERT_EQ(other[2u], entt::entity{4});
+
+    registry.commit_reserved();
+
+    ASSERT_EQ(registry.size(), 5u);
+    ASSERT_EQ(registry.alive(), 5u);
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_TRUE(registry.valid(other[0u]));
+    ASSERT_TRUE(registry.valid(other[1u]));
+    ASSERT_TRUE(registry.valid(other[2u]));
+    ASSERT_EQ(registry.destroyed(), entt::entity{entt::null});
+
+    registry.destroy(other[1u]);
+    registry.commit_reserved();
+
+    ASSERT_EQ(registry.alive(), 4u);
+    const auto recycled = registry.create();
+
+    ASSERT_EQ(registry.entity(recycled), entt::entity{3});
+    ASSERT_EQ(registry.version(recycled), 1u);
+}
+
+TEST(Registry, ReserveEntitiesConcurrently) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000u);
+    std::vector<std::thread> threads;
+
+    registry.create(entities.begin(), entities.end());
+    registry.destroy(entities.begin() + 500u, entities.end());
+
+    std::vector<entt::entity> reserved(1000u);
+
+    for(auto pos = 0u; pos < 4u; ++pos) {
+        threads.emplace_back([&registry, first = reserved.begin() + pos * 250u]() {
+            for(auto next = 0u; next < 50u; ++next) {
+                registry.reserve_entities(first + next * 5u, first + next * 5u + 5u);
+            }
+        });
+    }
+
+    for(auto &&thread: threads) {
+        thread.join();
+    }
+
+    registry.commit_reserved();
+
+    ASSERT_EQ(registry.size(), 1500u);
+    ASSERT_EQ(registry.alive(), 1500u);
+
+    std::unordered_set<entt::entity> unique{reserved.begin(), reserved.end()};
+
+    ASSERT_EQ(unique.size(), 1000u);
+
+    for(auto entity: reserved) {
+        ASSERT_TRUE(registry.valid(entity));
+    }
+}
+
 TEST(Registry, CreateWithHint) {
     entt::registry registry;
     auto e3 = registry.create(entt::entity{3});
@@ -624,6 +785,22 @@ TEST(Registry, FullOwningGroupInitOnFirstUse) {
     ASSERT_EQ(cnt, 2u);
 }
 
+TEST(Registry, Independent) {
+    entt::registry registry;
+
+    ASSERT_TRUE((registry.independent<int, char, double>()));
+
+    static_cast<void>(registry.group<int>(entt::get<char>));
+
+    ASSERT_FALSE((registry.independent<int, char>()));
+    ASSERT_TRUE((registry.independent<int, double>()));
+
+    static_cast<void>(registry.group<>(entt::get<double>, entt::exclude<float>));
+
+    ASSERT_TRUE((registry.independent<int, double>()));
+    ASSERT_FALSE((registry.independent<double, float>()));
+}
+
 TEST(Registry, FullOwningGroupInitOnEmplace) {
     entt::registry registry;
     auto group = registry.group<int, char>();
@@ -688,6 +865,164 @@ TEST(Registry, PartialOwningGroupInitOnEmplace) {
     ASSERT_EQ(cnt, 2u);
 }
 
+TEST(Registry, InPlaceDeletion) {
+    entt::registry registry;
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<stable_type>(std::begin(entities), std::end(entities));
+
+    const auto *instance = &registry.get<stable_type>(entities[2u]);
+    registry.destroy(entities[1u]);
+
+    ASSERT_EQ(&registry.get<stable_type>(entities[2u]), instance);
+    ASSERT_EQ(registry.size<stable_type>(), 3u);
+
+    registry.clear<stable_type>();
+
+    ASSERT_TRUE(registry.empty<stable_type>());
+
+    registry.insert<stable_type>(entities, entities + 1u);
+    registry.destroy(entities[0u]);
+    registry.emplace<stable_type>(entities[2u]);
+    registry.clear();
+
+    ASSERT_TRUE(registry.empty<stable_type>());
+}
+
+TEST(Registry, ChangeTicks) {
+    entt::registry registry;
+    entt::entity entities[3];
+
+    ASSERT_EQ(registry.current_tick(), 0u);
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<tracked_type>(entities[0u], 0);
+    registry.emplace<tracked_empty_type>(entities[0u]);
+
+    ASSERT_EQ(registry.advance_tick(), 1u);
+    ASSERT_EQ(registry.current_tick(), 1u);
+
+    registry.insert<tracked_type>(std::begin(entities) + 1u, std::end(entities));
+    registry.advance_tick();
+    registry.patch<tracked_type>(entities[0u], [](auto &instance) { instance.value = 42; });
+    registry.patch<tracked_empty_type>(entities[0u]);
+    registry.advance_tick();
+    registry.replace<tracked_type>(entities[2u], 3);
+
+    ASSERT_EQ(registry.added_tick<tracked_type>(entities[0u]), 0u);
+    ASSERT_EQ(registry.changed_tick<tracked_type>(entities[0u]), 2u);
+    ASSERT_EQ(registry.added_tick<tracked_empty_type>(entities[0u]), 0u);
+    ASSERT_EQ(registry.changed_tick<tracked_empty_type>(entities[0u]), 2u);
+    ASSERT_EQ(registry.added_tick<tracked_type>(entities[1u]), 1u);
+    ASSERT_EQ(registry.changed_tick<tracked_type>(entities[1u]), 1u);
+    ASSERT_EQ(registry.added_tick<tracked_type>(entities[2u]), 1u);
+    ASSERT_EQ(registry.changed_tick<tracked_type>(entities[2u]), 3u);
+
+    registry.sort<tracked_type>([](const auto &lhs, const auto &rhs) { return lhs.value < rhs.value; });
+
+    ASSERT_EQ(registry.changed_tick<tracked_type>(entities[0u]), 2u);
+    ASSERT_EQ(registry.changed_tick<tracked_type>(entities[1u]), 1u);
+    ASSERT_EQ(registry.changed_tick<tracked_type>(entities[2u]), 3u);
+
+    registry.remove<tracked_type>(entities[0u]);
+
+    ASSERT_EQ(registry.changed_tick<tracked_type>(entities[1u]), 1u);
+    ASSERT_EQ(registry.changed_tick<tracked_type>(entities[2u]), 3u);
+
+    registry.advance_tick();
+    registry.emplace_or_replace<tracked_type>(entities[0u]);
+    registry.emplace_or_replace<tracked_type>(entities[1u]);
+
+    ASSERT_EQ(registry.added_tick<tracked_type>(entities[0u]), 4u);
+    ASSERT_EQ(registry.added_tick<tracked_type>(entities[1u]), 1u);
+    ASSERT_EQ(registry.changed_tick<tracked_type>(entities[1u]), 4u);
+
+    registry.clear<tracked_type>();
+    registry.emplace<tracked_type>(entities[2u]);
+
+    ASSERT_EQ(registry.added_tick<tracked_type>(entities[2u]), 4u);
+}
+
+TEST(Registry, ChangeTicksInPlaceDeletion) {
+    entt::registry registry;
+    entt::storage_traits<entt::entity, stable_tracked_type>::storage_type pool;
+    entt::entity entities[4];
+
+    registry.create(std::begin(entities), std::end(entities));
+
+    for(auto pos = 0u; pos < 3u; ++pos) {
+        pool.emplace(registry, entities[pos]);
+        registry.advance_tick();
+    }
+
+    pool.remove(registry, entities[1u]);
+    pool.emplace(registry, entities[3u]);
+
+    ASSERT_EQ(pool.index(entities[3u]), 1u);
+    ASSERT_EQ(pool.added(entities[0u]), 0u);
+    ASSERT_EQ(pool.added(entities[2u]), 2u);
+    ASSERT_EQ(pool.added(entities[3u]), 3u);
+
+    pool.remove(registry, entities[0u]);
+    pool.compact();
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.added(entities[2u]), 2u);
+    ASSERT_EQ(pool.added(entities[3u]), 3u);
+
+    pool.remove(registry, entities[3u]);
+    pool.compact();
+    pool.emplace(registry, entities[1u]);
+    pool.swap(entities[1u], entities[2u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.added(entities[1u]), 3u);
+    ASSERT_EQ(pool.added(entities[2u]), 2u);
+}
+
+TEST(Registry, ChangedSince) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    ASSERT_EQ(registry.added_since<tracked_type>(0u).begin(), registry.added_since<tracked_type>(0u).end());
+
+    registry.emplace<tracked_type>(entity);
+    registry.emplace<stable_tracked_type>(entity);
+    const auto tick = registry.advance_tick();
+    registry.emplace<tracked_type>(other);
+    registry.emplace<stable_tracked_type>(other);
+
+    ASSERT_EQ(registry.added_since<tracked_type>(tick).begin(), registry.added_since<tracked_type>(tick).end());
+    ASSERT_EQ(*registry.added_since<tracked_type>(tick - 1u).begin(), other);
+    ASSERT_EQ(std::distance(registry.added_since<tracked_type>(tick - 1u).begin(), registry.added_since<tracked_type>(tick - 1u).end()), 1);
+
+    registry.advance_tick();
+    registry.patch<tracked_type>(entity);
+    registry.patch<stable_tracked_type>(entity);
+    registry.remove<stable_tracked_type>(entity);
+
+    std::size_t count{};
+
+    for(auto curr: registry.changed_since<tracked_type>(tick)) {
+        ASSERT_EQ(curr, entity);
+        ++count;
+    }
+
+    ASSERT_EQ(count, 1u);
+    // tombstones are skipped, their stale ticks notwithstanding
+    ASSERT_EQ(registry.changed_since<stable_tracked_type>(tick).begin(), registry.changed_since<stable_tracked_type>(tick).end());
+    ASSERT_EQ(*registry.changed_since<stable_tracked_type>(tick - 1u).begin(), other);
+
+    // ticks wrap around, those taken right before the wrap come first
+    const auto wrapped = (std::numeric_limits<entt::tick_type>::max)();
+
+    ASSERT_EQ(std::distance(registry.added_since<tracked_type>(wrapped).begin(), registry.added_since<tracked_type>(wrapped).end()), 2);
+    ASSERT_EQ(*registry.changed_since<tracked_type>(wrapped - 1u).begin(), entity);
+    ASSERT_EQ(registry.changed_since<tracked_type>(wrapped / 2u).begin(), registry.changed_since<tracked_type>(wrapped / 2u).end());
+}
+
 TEST(Registry, CleanViewAfterRemoveAndClear) {
     entt::registry registry;
     auto view = registry.view<int, char>();
@@ -983,6 +1318,47 @@ TEST(Registry, SortEmpty) {
     ASSERT_GT(registry.view<empty_type>().data()[1], registry.view<empty_type>().data()[2]);
 }
 
+TEST(Registry, SortStable) {
+    entt::registry registry;
+    entt::entity entities[4u];
+
+    registry.create(std::begin(entities), std::end(entities));
+
+    for(auto pos = 0u; pos < 4u; ++pos) {
+        registry.emplace<stable_type>(entities[pos], static_cast<int>(pos));
+        registry.emplace<stable_tracked_type>(entities[pos], static_cast<int>(pos));
+        registry.emplace<int>(entities[pos], static_cast<int>(pos));
+    }
+
+    registry.remove<stable_type>(entities[1u]);
+    registry.remove<stable_tracked_type>(entities[2u]);
+
+    ASSERT_EQ(registry.size<stable_type>(), 4u);
+
+    registry.sort<stable_type>([](const auto &lhs, const auto &rhs) { return lhs.value < rhs.value; });
+
+    ASSERT_EQ(registry.size<stable_type>(), 3u);
+
+    int expected[3u]{0, 2, 3};
+    auto *curr = std::begin(expected);
+
+    for(auto entity: registry.view<stable_type>()) {
+        ASSERT_EQ(registry.get<stable_type>(entity).value, *(curr++));
+    }
+
+    registry.sort<int>(std::greater<int>{});
+    registry.sort<stable_tracked_type, int>();
+
+    ASSERT_EQ(registry.size<stable_tracked_type>(), 3u);
+
+    expected[1u] = 1;
+    curr = std::end(expected);
+
+    for(auto entity: registry.view<stable_tracked_type>()) {
+        ASSERT_EQ(registry.get<stable_tracked_type>(entity).value, *(--curr));
+    }
+}
+
 TEST(Registry, ComponentsWithTypesFromStandardTemplateLibrary) {
     // see #37 - the test shouldn't crash, that's all
     entt::registry registry;
@@ -1113,6 +1489,117 @@ TEST(Registry, Signals) {
     ASSERT_EQ(listener.last, e0);
 }
 
+TEST(Registry, RangeSignals) {
+    entt::registry registry;
+    entt::entity entities[3u];
+    listener listener;
+
+    registry.on_construct_range<int>().connect<&listener::incr_range<int>>(listener);
+    registry.on_destroy_range<int>().connect<&listener::decr_range<int>>(listener);
+    registry.on_construct_range<empty_type>().connect<&listener::incr_range<empty_type>>(listener);
+    registry.on_destroy_range<empty_type>().connect<&listener::decr_range<empty_type>>(listener);
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(listener.spans, 1);
+
+    registry.insert<empty_type>(std::rbegin(entities), std::rend(entities));
+
+    ASSERT_EQ(listener.counter, 6);
+    ASSERT_EQ(listener.spans, 2);
+
+    registry.remove<int>(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(listener.spans, 3);
+
+    registry.emplace<int>(entities[0u]);
+    registry.remove<empty_type>(entities[1u]);
+
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(listener.spans, 5);
+
+    registry.destroy(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_EQ(listener.spans, 7);
+
+    registry.on_construct_range<int>().disconnect(listener);
+    registry.on_destroy_range<int>().disconnect(listener);
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.clear<int>();
+
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_EQ(listener.spans, 7);
+}
+
+TEST(Registry, RangeSignalsAfterOwningGroups) {
+    entt::registry registry;
+    const auto group = registry.group<int>(entt::get<char>);
+    listener listener;
+
+    registry.on_construct_range<int>().connect<&listener::incr_range<int>>(listener);
+
+    entt::entity entities[2u];
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<char>(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::begin(entities) + 1u);
+
+    ASSERT_EQ(listener.last, entities[0u]);
+
+    registry.emplace<int>(registry.create());
+    registry.insert<int>(std::begin(entities) + 1u, std::end(entities));
+
+    ASSERT_EQ(group.size(), 2u);
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(listener.last, entities[1u]);
+}
+
+TEST(Registry, RangeSignalsWithGroups) {
+    entt::registry registry;
+    entt::entity entities[4u];
+
+    const auto owning = registry.group<int>(entt::get<char>, entt::exclude<double>);
+    const auto non_owning = registry.group(entt::get<int, char>);
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+
+    ASSERT_TRUE(owning.empty());
+    ASSERT_TRUE(non_owning.empty());
+
+    registry.insert<char>(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(owning.size(), 4u);
+    ASSERT_EQ(non_owning.size(), 4u);
+
+    registry.insert<double>(std::begin(entities), std::begin(entities) + 2u);
+
+    ASSERT_EQ(owning.size(), 2u);
+    ASSERT_EQ(non_owning.size(), 4u);
+    ASSERT_FALSE(owning.contains(entities[0u]));
+    ASSERT_TRUE(owning.contains(entities[3u]));
+
+    registry.remove<char>(std::begin(entities) + 1u, std::begin(entities) + 3u);
+
+    ASSERT_EQ(owning.size(), 1u);
+    ASSERT_EQ(non_owning.size(), 2u);
+    ASSERT_TRUE(owning.contains(entities[3u]));
+
+    registry.remove<double>(std::begin(entities), std::begin(entities) + 2u);
+
+    ASSERT_EQ(owning.size(), 2u);
+    ASSERT_TRUE(owning.contains(entities[0u]));
+
+    registry.destroy(std::begin(entities), std::end(entities));
+
+    ASSERT_TRUE(owning.empty());
+    ASSERT_TRUE(non_owning.empty());
+}
+
 TEST(Registry, RangeDestroy) {
     entt::registry registry;
 
@@ -1142,6 +1629,11 @@ TEST(Registry, RangeDestroy) {
     ASSERT_FALSE(registry.valid(e1));
     ASSERT_TRUE(registry.valid(e2));
 
+    ASSERT_EQ(registry.size<int>(), 1u);
+    ASSERT_TRUE(registry.empty<char>());
+    ASSERT_TRUE(registry.empty<double>());
+    ASSERT_EQ(registry.alive(), 1u);
+
     {
         const auto view = registry.view<int>();
         registry.destroy(view.begin(), view.end());
@@ -1152,6 +1644,41 @@ TEST(Registry, RangeDestroy) {
     ASSERT_FALSE(registry.valid(e2));
 }
 
+TEST(Registry, RangeDestroySmallPools) {
+    entt::registry registry;
+    entt::entity entities[8u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<char>(entities[1u]);
+    registry.emplace<char>(entities[6u]);
+    registry.emplace<stable_type>(entities[0u]);
+    registry.emplace<stable_type>(entities[2u]);
+    registry.emplace<stable_type>(entities[7u]);
+    registry.remove<stable_type>(entities[0u]);
+
+    // pools smaller than the range are checked against the range, tombstones included
+    registry.destroy(std::begin(entities) + 1u, std::end(entities) - 1u);
+
+    ASSERT_EQ(registry.alive(), 2u);
+    ASSERT_TRUE(registry.valid(entities[0u]));
+    ASSERT_TRUE(registry.valid(entities[7u]));
+    ASSERT_TRUE(registry.empty<char>());
+    ASSERT_FALSE(registry.has<stable_type>(entities[0u]));
+    ASSERT_TRUE(registry.has<stable_type>(entities[7u]));
+}
+
+TEST(Registry, RangeDestroyDuplicates) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const entt::entity entities[2u]{entity, entity};
+
+    registry.emplace<int>(entity);
+
+    ASSERT_DEATH(registry.destroy(std::begin(entities), std::end(entities)), ".*");
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_TRUE(registry.has<int>(entity));
+}
+
 TEST(Registry, Insert) {
     entt::registry registry;
 
@@ -1410,6 +1937,143 @@ TEST(Registry, AssignEntities) {
     ASSERT_EQ(other.entity(other.create()), entities[1]);
 }
 
+TEST(Registry, Clone) {
+    entt::registry registry;
+    entt::entity entities[2048u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.destroy(entities[3u]);
+
+    for(std::size_t pos{}; pos < std::size(entities); ++pos) {
+        if(registry.valid(entities[pos])) {
+            registry.emplace<int>(entities[pos], static_cast<int>(pos));
+            registry.emplace<stable_type>(entities[pos], static_cast<int>(pos));
+            registry.emplace<std::shared_ptr<int>>(entities[pos], std::make_shared<int>(static_cast<int>(pos)));
+
+            if(pos % 2u) {
+                registry.emplace<empty_type>(entities[pos]);
+            }
+        }
+    }
+
+    registry.remove<stable_type>(entities[1u]);
+    registry.advance_tick();
+    registry.emplace<tracked_type>(entities[0u], 42);
+
+    listener listener;
+    registry.on_construct<int>().connect<&listener::incr<int>>(listener);
+    registry.set<char>('c');
+
+    auto clone = registry.clone();
+
+    ASSERT_EQ(clone.size(), registry.size());
+    ASSERT_EQ(clone.alive(), registry.alive());
+    ASSERT_EQ(clone.destroyed(), registry.destroyed());
+    ASSERT_EQ(clone.current_tick(), registry.current_tick());
+    ASSERT_EQ(clone.added_tick<tracked_type>(entities[0u]), 1u);
+    ASSERT_EQ(clone.try_ctx<char>(), nullptr);
+
+    ASSERT_EQ(clone.size<int>(), registry.size<int>());
+    ASSERT_EQ(clone.size<stable_type>(), registry.size<stable_type>());
+    ASSERT_EQ(clone.size<empty_type>(), registry.size<empty_type>());
+    ASSERT_FALSE(clone.has<stable_type>(entities[1u]));
+
+    for(auto entity: registry.view<int>()) {
+        ASSERT_EQ(clone.get<int>(entity), registry.get<int>(entity));
+        ASSERT_EQ(clone.get<std::shared_ptr<int>>(entity), registry.get<std::shared_ptr<int>>(entity));
+        ASSERT_EQ(clone.has<empty_type>(entity), registry.has<empty_type>(entity));
+    }
+
+    clone.emplace<int>(clone.create());
+    clone.patch<int>(entities[0u], [](auto &value) { value = 42; });
+
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_EQ(registry.get<int>(entities[0u]), 0);
+    ASSERT_EQ(clone.storage(entt::type_id<int>())->value_type(), entt::type_id<int>());
+
+    registry = clone.clone();
+
+    ASSERT_EQ(registry.get<int>(entities[0u]), 42);
+    ASSERT_EQ(registry.size<int>(), clone.size<int>());
+}
+
+TEST(Registry, Assign) {
+    entt::registry registry;
+    entt::registry other;
+    listener listener;
+
+    registry.on_construct<int>().connect<&listener::incr<int>>(listener);
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 42);
+    registry.emplace<char>(entity, 'c');
+    registry.set<char>('c');
+
+    other.create();
+    other.emplace<int>(other.create(), 3);
+    other.emplace<double>(other.create(), 0.);
+
+    registry.assign(other);
+
+    ASSERT_EQ(listener.counter, 1);
+    ASSERT_EQ(registry.size(), other.size());
+    ASSERT_EQ(registry.alive(), 3u);
+    ASSERT_EQ(registry.size<int>(), 1u);
+    ASSERT_EQ(registry.get<int>(entt::entity{1}), 3);
+    ASSERT_TRUE(registry.empty<char>());
+    ASSERT_TRUE(registry.has<double>(entt::entity{2}));
+    ASSERT_NE(registry.try_ctx<char>(), nullptr);
+
+    const auto *data = registry.view<int>().raw();
+    other.replace<int>(entt::entity{1}, 42);
+    registry.assign(other);
+
+    ASSERT_EQ(registry.view<int>().raw(), data);
+    ASSERT_EQ(registry.get<int>(entt::entity{1}), 42);
+
+    // pools that don't exist in the other registry keep their memory
+    entt::registry source;
+    source.create();
+    const auto *instances = registry.view<double>().raw();
+    const auto capacity = registry.capacity<double>();
+    registry.assign(source);
+
+    ASSERT_TRUE(registry.empty<double>());
+    ASSERT_EQ(registry.view<double>().raw(), instances);
+    ASSERT_EQ(registry.capacity<double>(), capacity);
+
+    registry.emplace<int>(entt::entity{0});
+
+    ASSERT_EQ(listener.counter, 2);
+}
+
+TEST(Registry, AssignNoSignals) {
+    entt::registry registry;
+    entt::registry other;
+    listener listener;
+
+    registry.on_destroy<int>().connect<&listener::incr<int>>(listener);
+    registry.on_destroy<char>().connect<&listener::incr<char>>(listener);
+    registry.on_destroy<std::unique_ptr<int>>().connect<&listener::incr<std::unique_ptr<int>>>(listener);
+    registry.on_destroy_range<std::unique_ptr<int>>().connect<&listener::incr_range<std::unique_ptr<int>>>(listener);
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 42);
+    registry.emplace<char>(entity, 'c');
+    registry.emplace<std::unique_ptr<int>>(entity, new int{3});
+
+    other.emplace<int>(other.create(), 3);
+
+    // pools of non-copyable components are emptied silently as well
+    registry.assign(other);
+
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_EQ(listener.spans, 0);
+    ASSERT_EQ(registry.size<int>(), 1u);
+    ASSERT_TRUE(registry.empty<char>());
+    ASSERT_TRUE(registry.empty<std::unique_ptr<int>>());
+}
+
 TEST(Registry, Visit) {
     entt::registry registry;
     const auto entity = registry.create();
@@ -0,0 +1,137 @@
+#include <string>
+#include <gtest/gtest.h>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/rollback.hpp>
+
+struct tracked_type {
+    static constexpr auto track_changes = true;
+    int value;
+};
+
+struct listener {
+    void incr(const entt::registry &, entt::entity) {
+        ++counter;
+    }
+
+    int counter{};
+};
+
+TEST(Rollback, Functionalities) {
+    entt::registry registry;
+    entt::rollback rollback{registry, 4u};
+
+    ASSERT_EQ(rollback.capacity(), 4u);
+    ASSERT_FALSE(rollback.contains(0u));
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 0);
+    registry.emplace<std::string>(entity, "0");
+    rollback.capture(0u);
+
+    const auto other = registry.create();
+    registry.emplace<int>(other, 1);
+    registry.patch<int>(entity, [](auto &value) { value = 1; });
+    registry.remove<std::string>(entity);
+    registry.emplace<char>(entity, 'c');
+    rollback.capture(1u);
+
+    ASSERT_TRUE(rollback.contains(0u));
+    ASSERT_TRUE(rollback.contains(1u));
+    ASSERT_FALSE(rollback.contains(2u));
+
+    ASSERT_EQ(rollback.state(0u).size(), 1u);
+    ASSERT_EQ(rollback.state(1u).size(), 2u);
+
+    registry.destroy(entity);
+    registry.emplace<double>(other, 2.);
+
+    rollback.restore(0u);
+
+    ASSERT_TRUE(rollback.contains(0u));
+    ASSERT_FALSE(rollback.contains(1u));
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_FALSE(registry.valid(other));
+    ASSERT_EQ(registry.size(), 1u);
+    ASSERT_EQ(registry.get<int>(entity), 0);
+    ASSERT_EQ(registry.get<std::string>(entity), "0");
+    ASSERT_FALSE(registry.has<char>(entity));
+    ASSERT_TRUE(registry.empty<double>());
+
+    ASSERT_EQ(registry.create(), other);
+
+    rollback.clear();
+
+    ASSERT_FALSE(rollback.contains(0u));
+}
+
+TEST(Rollback, Ring) {
+    entt::registry registry;
+    entt::rollback rollback{registry, 2u};
+    const auto entity = registry.create();
+
+    for(int frame{}; frame < 5; ++frame) {
+        registry.emplace_or_replace<int>(entity, frame);
+        rollback.capture(static_cast<entt::rollback::size_type>(frame));
+    }
+
+    ASSERT_FALSE(rollback.contains(2u));
+    ASSERT_TRUE(rollback.contains(3u));
+    ASSERT_TRUE(rollback.contains(4u));
+
+    rollback.restore(3u);
+
+    ASSERT_EQ(registry.get<int>(entity), 3);
+    ASSERT_FALSE(rollback.contains(4u));
+
+    registry.replace<int>(entity, 42);
+    rollback.capture(4u);
+    rollback.restore(4u);
+
+    ASSERT_EQ(registry.get<int>(entity), 42);
+    ASSERT_TRUE(rollback.contains(3u));
+}
+
+TEST(Rollback, Listeners) {
+    entt::registry registry;
+    entt::rollback rollback{registry, 1u};
+    listener construction{};
+    listener destruction{};
+
+    registry.on_construct<int>().connect<&listener::incr>(construction);
+    registry.on_destroy<int>().connect<&listener::incr>(destruction);
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 42);
+    rollback.capture(0u);
+
+    registry.remove<int>(entity);
+    rollback.restore(0u);
+
+    ASSERT_EQ(registry.get<int>(entity), 42);
+    ASSERT_EQ(construction.counter, 1);
+    ASSERT_EQ(destruction.counter, 1);
+
+    registry.remove<int>(entity);
+
+    ASSERT_EQ(destruction.counter, 2);
+}
+
+TEST(Rollback, ChangeTicks) {
+    entt::registry registry;
+    entt::rollback rollback{registry, 2u};
+
+    const auto entity = registry.create();
+    registry.emplace<tracked_type>(entity);
+    registry.advance_tick();
+    rollback.capture(0u);
+
+    const auto tick = registry.current_tick();
+    registry.patch<tracked_type>(entity, [](auto &instance) { instance.value = 42; });
+    registry.advance_tick();
+    rollback.restore(0u);
+
+    ASSERT_EQ(registry.current_tick(), tick);
+    ASSERT_LT(registry.changed_tick<tracked_type>(entity), tick);
+    ASSERT_EQ(registry.get<tracked_type>(entity).value, 0);
+}
@@ -1,9 +1,15 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <map>
 #include <tuple>
 #include <queue>
 #include <vector>
 #include <type_traits>
 #include <gtest/gtest.h>
+#include <entt/core/thread_pool.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/snapshot.hpp>
 #include <entt/entity/entity.hpp>
@@ -65,6 +71,36 @@ private:
     Storage &storage;
 };
 
+struct binary_output_archive {
+    void operator()(const void *data, std::size_t length) {
+        const auto *first = static_cast<const char *>(data);
+        buffer.insert(buffer.end(), first, first + length);
+    }
+
+    std::vector<char> buffer{};
+};
+
+struct binary_input_archive {
+    void operator()(void *data, std::size_t length) {
+        std::copy_n(buffer.data() + offset, length, static_cast<char *>(data));
+        offset += length;
+    }
+
+    const std::vector<char> &buffer;
+    std::size_t offset{};
+};
+
+struct stable_component {
+    static constexpr auto in_place_delete = true;
+    int value;
+};
+
+struct tracked_component {
+    static constexpr auto track_changes = true;
+    entt::entity target;
+    int value;
+};
+
 struct a_component {};
 
 struct another_component {
@@ -502,6 +538,125 @@ TEST(Snapshot, Continuous) {
     ASSERT_EQ(dst.size<a_component>(), a_component_cnt);
 }
 
+TEST(Snapshot, Delta) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry src;
+    entt::registry dst;
+
+    entt::delta_snapshot snapshot{src};
+    entt::continuous_loader loader{dst};
+
+    using storage_type = std::tuple<
+        std::queue<typename traits_type::entity_type>,
+        std::queue<entt::entity>,
+        std::queue<tracked_component>,
+        std::queue<int>
+    >;
+
+    storage_type storage;
+    output_archive<storage_type> output{storage};
+    input_archive<storage_type> input{storage};
+
+    entt::entity entities[4u];
+    src.create(std::begin(entities), std::end(entities));
+
+    for(auto entity: entities) {
+        src.emplace<tracked_component>(entity, entities[0u], 0);
+    }
+
+    src.emplace<int>(entities[1u], 42);
+    src.advance_tick();
+
+    snapshot.entities(output).component<tracked_component, int>(output);
+    ASSERT_EQ(std::get<std::queue<tracked_component>>(storage).size(), 4u);
+
+    loader.entities_delta(input).component_delta<tracked_component, int>(input, &tracked_component::target);
+
+    ASSERT_EQ(dst.alive(), 4u);
+    ASSERT_EQ(dst.size<tracked_component>(), 4u);
+    ASSERT_EQ(dst.get<int>(loader.map(entities[1u])), 42);
+
+    src.advance_tick();
+    src.patch<tracked_component>(entities[2u], [](auto &instance) { instance.value = 3; });
+    src.remove<tracked_component>(entities[3u]);
+    src.destroy(entities[1u]);
+
+    const auto entity = src.create();
+    src.emplace<tracked_component>(entity, entities[2u], 99);
+    src.advance_tick();
+
+    snapshot.entities(output).component<tracked_component, int>(output);
+    ASSERT_EQ(std::get<std::queue<tracked_component>>(storage).size(), 2u);
+
+    loader.entities_delta(input).component_delta<tracked_component, int>(input, &tracked_component::target);
+
+    ASSERT_FALSE(dst.valid(loader.map(entities[1u])));
+    ASSERT_TRUE(dst.valid(loader.map(entity)));
+    ASSERT_EQ(dst.alive(), src.alive());
+    ASSERT_EQ(dst.size<tracked_component>(), src.size<tracked_component>());
+    ASSERT_EQ(dst.size<int>(), 0u);
+
+    ASSERT_FALSE(dst.has<tracked_component>(loader.map(entities[3u])));
+    ASSERT_EQ(dst.get<tracked_component>(loader.map(entities[0u])).value, 0);
+    ASSERT_EQ(dst.get<tracked_component>(loader.map(entities[2u])).value, 3);
+    ASSERT_EQ(dst.get<tracked_component>(loader.map(entity)).value, 99);
+    ASSERT_EQ(dst.get<tracked_component>(loader.map(entity)).target, loader.map(entities[2u]));
+
+    snapshot.entities(output).component<tracked_component, int>(output);
+
+    ASSERT_EQ(std::get<std::queue<entt::entity>>(storage).size(), 0u);
+    ASSERT_EQ(std::get<std::queue<tracked_component>>(storage).size(), 0u);
+
+    loader.entities_delta(input).component_delta<tracked_component, int>(input, &tracked_component::target);
+
+    ASSERT_EQ(dst.alive(), src.alive());
+    ASSERT_EQ(dst.size<tracked_component>(), src.size<tracked_component>());
+}
+
+TEST(Snapshot, DeltaWrapAround) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry src;
+    entt::registry dst;
+
+    entt::delta_snapshot snapshot{src};
+    entt::continuous_loader loader{dst};
+
+    using storage_type = std::tuple<
+        std::queue<typename traits_type::entity_type>,
+        std::queue<entt::entity>,
+        std::queue<tracked_component>
+    >;
+
+    storage_type storage;
+    output_archive<storage_type> output{storage};
+    input_archive<storage_type> input{storage};
+
+    const auto entity = src.create();
+    src.emplace<tracked_component>(entity, entity, 0);
+    src.advance_tick((std::numeric_limits<entt::tick_type>::max)() - 1u);
+
+    snapshot.entities(output).component<tracked_component>(output);
+    loader.entities_delta(input).component_delta<tracked_component>(input, &tracked_component::target);
+
+    ASSERT_EQ(dst.get<tracked_component>(loader.map(entity)).value, 0);
+
+    // the change tick wraps around, later changes must still be sent
+    src.advance_tick(3u);
+    src.patch<tracked_component>(entity, [](auto &instance) { instance.value = 42; });
+
+    ASSERT_LT(src.current_tick(), (std::numeric_limits<entt::tick_type>::max)() / 2u);
+
+    snapshot.entities(output).component<tracked_component>(output);
+
+    ASSERT_EQ(std::get<std::queue<tracked_component>>(storage).size(), 1u);
+
+    loader.entities_delta(input).component_delta<tracked_component>(input, &tracked_component::target);
+
+    ASSERT_EQ(dst.get<tracked_component>(loader.map(entity)).value, 42);
+}
+
 TEST(Snapshot, MoreOnShrink) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -530,6 +685,71 @@ TEST(Snapshot, MoreOnShrink) {
     ASSERT_FALSE(dst.valid(entity));
 }
 
+TEST(Snapshot, RecycledOnDestroy) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry src;
+    entt::registry dst;
+
+    entt::continuous_loader loader{dst};
+
+    using storage_type = std::tuple<
+        std::queue<typename traits_type::entity_type>,
+        std::queue<entt::entity>
+        >;
+
+    storage_type storage;
+    output_archive<storage_type> output{storage};
+    input_archive<storage_type> input{storage};
+
+    const auto identifier = [](auto entity, auto version) {
+        return entt::entity{entity | (typename traits_type::entity_type{version} << traits_type::entity_shift)};
+    };
+
+    entt::entity entities[2u];
+    src.create(std::begin(entities), std::end(entities));
+    src.destroy(entities[0u]);
+    entities[0u] = src.create();
+    src.destroy(entities[1u]);
+    src.destroy(entities[0u]);
+
+    // the first slot of the free list refers to the second entity
+    entt::snapshot{src}.entities(output);
+    loader.entities(input).shrink();
+
+    ASSERT_TRUE(loader.contains(identifier(1u, 2u)));
+
+    const auto stale = loader.map(identifier(1u, 2u));
+    src.create(std::begin(entities), std::end(entities));
+    entt::snapshot{src}.entities(output);
+    loader.entities(input).shrink();
+
+    // live remote entities always replace other versions
+    ASSERT_FALSE(loader.contains(identifier(1u, 2u)));
+    ASSERT_TRUE(loader.contains(entities[1u]));
+    ASSERT_TRUE(dst.valid(loader.map(entities[1u])));
+    ASSERT_NE(loader.map(entities[1u]), stale);
+
+    const auto local = loader.map(entities[1u]);
+    src.destroy(entities[1u]);
+    src.destroy(entities[0u]);
+    entt::snapshot{src}.entities(output);
+    loader.entities(input);
+
+    // destroyed remote entities don't replace live local counterparts
+    ASSERT_FALSE(loader.contains(identifier(1u, 3u)));
+    ASSERT_EQ(loader.map(entities[1u]), local);
+
+    loader.shrink();
+    entt::snapshot{src}.entities(output);
+    loader.entities(input);
+
+    // they replace stale ones instead
+    ASSERT_TRUE(loader.contains(identifier(1u, 3u)));
+    ASSERT_FALSE(dst.valid(local));
+    ASSERT_FALSE(dst.valid(loader.map(identifier(1u, 3u))));
+}
+
 TEST(Snapshot, SyncDataMembers) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -597,3 +817,335 @@ TEST(Snapshot, SyncDataMembers) {
     ASSERT_EQ(foobar.values.at(10), loader.map(child));
     ASSERT_EQ(foobar.both.at(loader.map(child)), loader.map(child));
 }
+
+TEST(Snapshot, Binary) {
+    entt::registry src;
+    entt::registry dst;
+    entt::entity entities[2048u];
+
+    src.create(std::begin(entities), std::end(entities));
+    src.destroy(entities[3u]);
+
+    for(std::size_t pos{}; pos < std::size(entities); ++pos) {
+        if(src.valid(entities[pos])) {
+            src.emplace<int>(entities[pos], static_cast<int>(pos));
+            src.emplace<another_component>(entities[pos], static_cast<int>(pos), -static_cast<int>(pos));
+
+            if(pos % 2u) {
+                src.emplace<a_component>(entities[pos]);
+            }
+        }
+    }
+
+    src.remove<int>(entities[0u]);
+
+    binary_output_archive output;
+    entt::binary_snapshot{src}.entities(output).component<int, a_component, another_component>(output);
+
+    binary_input_archive input{output.buffer};
+    entt::binary_snapshot_loader{dst}.entities(input).component<int, a_component, another_component>(input).orphans();
+
+    ASSERT_EQ(input.offset, output.buffer.size());
+    ASSERT_EQ(dst.size(), src.size());
+    ASSERT_EQ(dst.alive(), src.alive());
+    ASSERT_EQ(dst.destroyed(), src.destroyed());
+    ASSERT_FALSE(dst.valid(entities[3u]));
+
+    ASSERT_EQ(dst.size<int>(), src.size<int>());
+    ASSERT_EQ(dst.size<a_component>(), src.size<a_component>());
+    ASSERT_EQ(dst.size<another_component>(), src.size<another_component>());
+
+    for(auto entity: src.view<another_component>()) {
+        ASSERT_TRUE(dst.valid(entity));
+        ASSERT_EQ(dst.has<int>(entity), src.has<int>(entity));
+        ASSERT_EQ(dst.has<a_component>(entity), src.has<a_component>(entity));
+        ASSERT_EQ(dst.get<another_component>(entity).key, src.get<another_component>(entity).key);
+        ASSERT_EQ(dst.get<another_component>(entity).value, src.get<another_component>(entity).value);
+    }
+
+    for(auto entity: src.view<int>()) {
+        ASSERT_EQ(dst.get<int>(entity), src.get<int>(entity));
+    }
+}
+
+TEST(Snapshot, BinaryRejected) {
+    entt::registry src;
+    entt::entity entities[3u];
+
+    src.create(std::begin(entities), std::end(entities));
+    src.insert<int>(std::begin(entities), std::end(entities), 42);
+    src.insert<another_component>(std::begin(entities), std::end(entities));
+
+    binary_output_archive output;
+    entt::binary_snapshot{src}.entities(output).component<int, another_component>(output);
+
+    entt::registry dst;
+    binary_input_archive input{output.buffer};
+    entt::binary_snapshot_loader loader{dst};
+
+    ASSERT_TRUE(loader.entities(input));
+    ASSERT_FALSE((loader.component<another_component, int>(input)));
+    ASSERT_TRUE(dst.empty<int>());
+    ASSERT_TRUE(dst.empty<another_component>());
+
+    auto version = entt::binary_snapshot_version + 1u;
+    std::copy_n(reinterpret_cast<const char *>(&version), sizeof(version), output.buffer.begin());
+
+    entt::registry other;
+    binary_input_archive versioned{output.buffer};
+
+    ASSERT_FALSE((entt::binary_snapshot_loader{other}.entities(versioned).component<int, another_component>(versioned)));
+    ASSERT_EQ(versioned.offset, sizeof(entt::binary_snapshot_header));
+    ASSERT_EQ(other.size(), 0u);
+}
+
+TEST(Snapshot, BinaryInPlaceDeletion) {
+    entt::registry src;
+    entt::registry dst;
+    entt::entity entities[3u];
+
+    src.create(std::begin(entities), std::end(entities));
+
+    for(auto entity: entities) {
+        src.emplace<stable_component>(entity, static_cast<int>(entt::to_integral(entity)));
+    }
+
+    src.remove<stable_component>(entities[1u]);
+
+    binary_output_archive output;
+    entt::binary_snapshot{src}.entities(output).component<stable_component>(output);
+
+    // removed components don't end up in the archive
+    const auto removed = output.buffer.cend() - 2 * sizeof(stable_component);
+    ASSERT_TRUE(std::all_of(removed, removed + sizeof(stable_component), [](const char byte) { return byte == 0; }));
+
+    binary_input_archive input{output.buffer};
+    entt::binary_snapshot_loader{dst}.entities(input).component<stable_component>(input);
+
+    ASSERT_EQ(dst.size<stable_component>(), 2u);
+    ASSERT_FALSE(dst.has<stable_component>(entities[1u]));
+    ASSERT_EQ(dst.get<stable_component>(entities[0u]).value, static_cast<int>(entt::to_integral(entities[0u])));
+    ASSERT_EQ(dst.get<stable_component>(entities[2u]).value, static_cast<int>(entt::to_integral(entities[2u])));
+}
+
+TEST(Snapshot, Mapped) {
+    entt::registry src;
+    entt::registry dst;
+    entt::entity entities[2048u];
+
+    src.create(std::begin(entities), std::end(entities));
+    src.destroy(entities[3u]);
+
+    for(std::size_t pos{}; pos < std::size(entities); ++pos) {
+        if(src.valid(entities[pos])) {
+            src.emplace<int>(entities[pos], static_cast<int>(pos));
+            src.emplace<another_component>(entities[pos], static_cast<int>(pos), -static_cast<int>(pos));
+
+            if(pos % 2u) {
+                src.emplace<a_component>(entities[pos]);
+            }
+        }
+    }
+
+    src.remove<int>(entities[0u]);
+
+    binary_output_archive output;
+    entt::binary_snapshot{src}.entities(output).component<int, a_component, another_component>(output);
+
+    // an offset by one forces misaligned blocks, as it can happen with mapped files
+    std::vector<char> region(output.buffer.size() + 1u);
+    std::copy(output.buffer.cbegin(), output.buffer.cend(), region.begin() + 1u);
+
+    entt::mapped_snapshot_loader loader{dst, region.data() + 1u, output.buffer.size()};
+
+    ASSERT_TRUE(loader.contains<int>());
+    ASSERT_TRUE(loader.contains<a_component>());
+    ASSERT_FALSE(loader.contains<char>());
+
+    loader.entities().component<another_component, char, a_component, int>().orphans();
+
+    ASSERT_EQ(dst.size(), src.size());
+    ASSERT_EQ(dst.alive(), src.alive());
+    ASSERT_EQ(dst.destroyed(), src.destroyed());
+    ASSERT_FALSE(dst.valid(entities[3u]));
+
+    ASSERT_EQ(dst.size<int>(), src.size<int>());
+    ASSERT_EQ(dst.size<a_component>(), src.size<a_component>());
+    ASSERT_EQ(dst.size<another_component>(), src.size<another_component>());
+    ASSERT_EQ(dst.size<char>(), 0u);
+
+    for(auto entity: src.view<another_component>()) {
+        ASSERT_TRUE(dst.valid(entity));
+        ASSERT_EQ(dst.has<int>(entity), src.has<int>(entity));
+        ASSERT_EQ(dst.has<a_component>(entity), src.has<a_component>(entity));
+        ASSERT_EQ(dst.get<another_component>(entity).key, src.get<another_component>(entity).key);
+        ASSERT_EQ(dst.get<another_component>(entity).value, src.get<another_component>(entity).value);
+    }
+
+    for(auto entity: src.view<int>()) {
+        ASSERT_EQ(dst.get<int>(entity), src.get<int>(entity));
+    }
+}
+
+TEST(Snapshot, MappedPartial) {
+    entt::registry src;
+    entt::registry dst;
+    entt::entity entities[3u];
+
+    src.create(std::begin(entities), std::end(entities));
+
+    for(auto entity: entities) {
+        src.emplace<stable_component>(entity, static_cast<int>(entt::to_integral(entity)));
+        src.emplace<int>(entity, 42);
+    }
+
+    src.remove<stable_component>(entities[1u]);
+
+    binary_output_archive output;
+    entt::binary_snapshot{src}.entities(output).component<int, stable_component>(output);
+
+    // pools can be restored without their entities, these are created on demand
+    entt::mapped_snapshot_loader{dst, output.buffer.data(), output.buffer.size()}.component<stable_component>();
+
+    ASSERT_EQ(dst.alive(), 2u);
+    ASSERT_EQ(dst.size<int>(), 0u);
+    ASSERT_EQ(dst.size<stable_component>(), 2u);
+    ASSERT_FALSE(dst.valid(entities[1u]));
+    ASSERT_EQ(dst.get<stable_component>(entities[0u]).value, static_cast<int>(entt::to_integral(entities[0u])));
+    ASSERT_EQ(dst.get<stable_component>(entities[2u]).value, static_cast<int>(entt::to_integral(entities[2u])));
+}
+
+TEST(Snapshot, MappedRejected) {
+    entt::registry src;
+    entt::entity entities[3u];
+
+    src.create(std::begin(entities), std::end(entities));
+    src.insert<int>(std::begin(entities), std::end(entities), 42);
+
+    binary_output_archive output;
+    entt::binary_snapshot{src}.entities(output).component<int>(output);
+
+    entt::registry dst;
+
+    ASSERT_TRUE((entt::mapped_snapshot_loader{dst, output.buffer.data(), 0u}));
+
+    for(auto size: {output.buffer.size() - 1u, sizeof(entt::binary_snapshot_header) - 1u}) {
+        entt::mapped_snapshot_loader loader{dst, output.buffer.data(), size};
+
+        ASSERT_FALSE(loader);
+        ASSERT_FALSE(loader.contains<int>());
+
+        loader.entities().component<int>();
+
+        ASSERT_EQ(dst.size(), 0u);
+        ASSERT_EQ(dst.size<int>(), 0u);
+    }
+
+    entt::binary_snapshot_header header{};
+    std::copy_n(output.buffer.cbegin(), sizeof(header), reinterpret_cast<char *>(&header));
+
+    // sizes that overflow must not wrap around and pass the bounds checks
+    header.size = (std::numeric_limits<std::uint64_t>::max)() / sizeof(entt::entity) + 1u;
+    std::copy_n(reinterpret_cast<const char *>(&header), sizeof(header), output.buffer.begin());
+
+    ASSERT_FALSE((entt::mapped_snapshot_loader{dst, output.buffer.data(), output.buffer.size()}));
+
+    header.size = std::size(entities);
+    header.version = entt::binary_snapshot_version - 1u;
+    std::copy_n(reinterpret_cast<const char *>(&header), sizeof(header), output.buffer.begin());
+
+    ASSERT_FALSE((entt::mapped_snapshot_loader{dst, output.buffer.data(), output.buffer.size()}));
+}
+
+TEST(Snapshot, Parallel) {
+    entt::registry src;
+    entt::registry dst;
+    entt::entity entities[2048u];
+    entt::thread_pool pool{2u};
+
+    src.create(std::begin(entities), std::end(entities));
+    src.destroy(entities[3u]);
+
+    for(std::size_t pos{}; pos < std::size(entities); ++pos) {
+        if(src.valid(entities[pos])) {
+            src.emplace<another_component>(entities[pos], static_cast<int>(pos), -static_cast<int>(pos));
+
+            if(pos % 2u) {
+                src.emplace<a_component>(entities[pos]);
+            } else {
+                src.emplace<int>(entities[pos], static_cast<int>(pos));
+            }
+        }
+    }
+
+    binary_output_archive sequential;
+    binary_output_archive parallel;
+
+    entt::binary_snapshot{src}.entities(sequential).component<int, a_component, another_component>(sequential);
+    entt::binary_snapshot{src}.entities(parallel).component<int, a_component, another_component>(parallel, pool);
+
+    ASSERT_EQ(sequential.buffer, parallel.buffer);
+
+    entt::mapped_snapshot_loader{dst, parallel.buffer.data(), parallel.buffer.size()}.entities().component<another_component, int, a_component>(pool);
+
+    ASSERT_EQ(dst.size(), src.size());
+    ASSERT_EQ(dst.alive(), src.alive());
+    ASSERT_EQ(dst.size<int>(), src.size<int>());
+    ASSERT_EQ(dst.size<a_component>(), src.size<a_component>());
+    ASSERT_EQ(dst.size<another_component>(), src.size<another_component>());
+
+    for(auto entity: src.view<another_component>()) {
+        ASSERT_EQ(dst.has<int>(entity), src.has<int>(entity));
+        ASSERT_EQ(dst.has<a_component>(entity), src.has<a_component>(entity));
+        ASSERT_EQ(dst.get<another_component>(entity).key, src.get<another_component>(entity).key);
+    }
+
+    for(auto entity: src.view<int>()) {
+        ASSERT_EQ(dst.get<int>(entity), src.get<int>(entity));
+    }
+}
+
+TEST(Snapshot, ParallelWithoutEntities) {
+    entt::registry src;
+    entt::registry dst;
+    entt::entity entities[3u];
+    entt::thread_pool pool{2u};
+
+    src.create(std::begin(entities), std::end(entities));
+    src.emplace<int>(entities[0u], 0);
+    src.emplace<int>(entities[2u], 2);
+    src.emplace<a_component>(entities[1u]);
+
+    binary_output_archive output;
+    entt::binary_snapshot{src}.component<int, a_component>(output, pool);
+
+    // entities are created up front since pools are filled concurrently
+    entt::mapped_snapshot_loader{dst, output.buffer.data(), output.buffer.size()}.component<int, a_component>(pool);
+
+    ASSERT_EQ(dst.alive(), 3u);
+    ASSERT_EQ(dst.get<int>(entities[0u]), 0);
+    ASSERT_EQ(dst.get<int>(entities[2u]), 2);
+    ASSERT_TRUE(dst.has<a_component>(entities[1u]));
+}
+
+TEST(Snapshot, ParallelGroups) {
+    entt::registry src;
+    entt::registry dst;
+    entt::thread_pool pool{2u};
+
+    const auto entity = src.create();
+    src.emplace<int>(entity, 0);
+    src.emplace<a_component>(entity);
+
+    binary_output_archive output;
+    entt::binary_snapshot{src}.entities(output).component<int, a_component>(output, pool);
+
+    // group handlers would run concurrently on the threads that fill the pools
+    static_cast<void>(dst.group<int>(entt::get<a_component>));
+
+    ASSERT_DEATH((entt::mapped_snapshot_loader{dst, output.buffer.data(), output.buffer.size()}.entities().component<int, a_component>(pool)), ".*");
+
+    entt::mapped_snapshot_loader{dst, output.buffer.data(), output.buffer.size()}.entities().component<int, a_component>();
+
+    ASSERT_EQ(dst.group<int>(entt::get<a_component>).size(), 1u);
+}
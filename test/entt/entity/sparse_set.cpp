@@ -108,6 +108,39 @@ TEST(SparseSet, Pagination) {
     ASSERT_EQ(set.extent(), 0u);
 }
 
+TEST(SparseSet, Copy) {
+    entt::sparse_set set{entt::deletion_policy::in_place};
+    constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(entt::entity);
+
+    set.emplace(entt::entity{3});
+    set.emplace(entt::entity{entt_per_page});
+    set.emplace(entt::entity{42});
+    set.remove(entt::entity{3});
+
+    entt::sparse_set other{set};
+
+    ASSERT_EQ(other.policy(), entt::deletion_policy::in_place);
+    ASSERT_EQ(other.size(), set.size());
+    ASSERT_EQ(other.extent(), set.extent());
+    ASSERT_EQ(other.slot(), set.slot());
+    ASSERT_FALSE(other.contains(entt::entity{3}));
+    ASSERT_EQ(other.index(entt::entity{entt_per_page}), set.index(entt::entity{entt_per_page}));
+    ASSERT_EQ(other.index(entt::entity{42}), set.index(entt::entity{42}));
+
+    other.remove(entt::entity{42});
+
+    ASSERT_FALSE(other.contains(entt::entity{42}));
+    ASSERT_TRUE(set.contains(entt::entity{42}));
+
+    other.emplace(entt::entity{2u * entt_per_page});
+    other = set;
+
+    ASSERT_EQ(other.size(), set.size());
+    ASSERT_TRUE(other.contains(entt::entity{42}));
+    ASSERT_FALSE(other.contains(entt::entity{2u * entt_per_page}));
+    ASSERT_EQ(other.index(entt::entity{entt_per_page}), set.index(entt::entity{entt_per_page}));
+}
+
 TEST(SparseSet, Insert) {
     entt::sparse_set set;
     entt::entity entities[2];
@@ -171,6 +204,48 @@ TEST(SparseSet, Remove) {
     ASSERT_EQ(*set.begin(), entt::entity{42});
 }
 
+TEST(SparseSet, InPlaceDeletion) {
+    entt::sparse_set set{entt::deletion_policy::in_place};
+    entt::entity entities[3];
+
+    entities[0] = entt::entity{3};
+    entities[1] = entt::entity{42};
+    entities[2] = entt::entity{9};
+
+    ASSERT_EQ(set.policy(), entt::deletion_policy::in_place);
+
+    set.insert(std::begin(entities), std::end(entities));
+    set.remove(entities[1]);
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_FALSE(set.contains(entities[1]));
+    ASSERT_EQ(set.data()[1u], static_cast<entt::entity>(entt::null));
+    ASSERT_EQ(set.index(entities[2]), 2u);
+    ASSERT_EQ(set.slot(), 1u);
+
+    set.emplace(entt::entity{7});
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.index(entt::entity{7}), 1u);
+    ASSERT_EQ(set.slot(), 3u);
+
+    set.remove(entities[0]);
+    set.remove(entt::entity{7});
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.index(entities[2]), 2u);
+
+    set.compact();
+
+    ASSERT_EQ(set.size(), 1u);
+    ASSERT_EQ(set.index(entities[2]), 0u);
+    ASSERT_EQ(*set.begin(), entities[2]);
+
+    set.remove(entities[2]);
+
+    ASSERT_TRUE(set.empty());
+}
+
 TEST(SparseSet, Iterator) {
     using iterator = typename entt::sparse_set::iterator;
 
@@ -15,6 +15,16 @@ bool operator==(const boxed_int &lhs, const boxed_int &rhs) {
     return lhs.value == rhs.value;
 }
 
+struct paged_int {
+    static constexpr auto paged_packed = true;
+    int value;
+};
+
+struct stable_type {
+    static constexpr auto in_place_delete = true;
+    int value;
+};
+
 struct throwing_component {
     struct constructor_exception: std::exception {};
 
@@ -24,6 +34,28 @@ struct throwing_component {
     int data;
 };
 
+struct copy_throwing_type {
+    copy_throwing_type() { ++live; }
+
+    copy_throwing_type(const copy_throwing_type &) {
+        if(!budget) { throw std::exception{}; }
+        --budget;
+        ++live;
+    }
+
+    copy_throwing_type(copy_throwing_type &&) noexcept { ++live; }
+    ~copy_throwing_type() { --live; }
+
+    copy_throwing_type & operator=(const copy_throwing_type &) = default;
+    copy_throwing_type & operator=(copy_throwing_type &&) = default;
+
+    static inline int live{};
+    static inline int budget{};
+
+    // necessary to disable the empty type optimization
+    int data{};
+};
+
 TEST(Storage, Functionalities) {
     entt::storage<int> pool;
 
@@ -163,6 +195,201 @@ TEST(Storage, TypesFromStandardTemplateLibraryMustWork) {
     pool.remove(entt::entity{0});
 }
 
+TEST(Storage, Paginated) {
+    entt::storage<paged_int> pool;
+    const auto count = 2u * ENTT_PACKED_PAGE + 1u;
+
+    for(auto next = 0u; next < count; ++next) {
+        pool.emplace(entt::entity(next), static_cast<int>(next));
+    }
+
+    const auto *first = &pool.get(entt::entity{0});
+    const auto *last = &pool.get(entt::entity(count - 1u));
+
+    for(auto next = count; next < 4u * count; ++next) {
+        pool.emplace(entt::entity(next), static_cast<int>(next));
+    }
+
+    ASSERT_EQ(first, &pool.get(entt::entity{0}));
+    ASSERT_EQ(last, &pool.get(entt::entity(count - 1u)));
+    ASSERT_EQ(pool.raw()[0u][0u].value, 0);
+    ASSERT_EQ(pool.raw()[2u][0u].value, static_cast<int>(2u * ENTT_PACKED_PAGE));
+    ASSERT_EQ(pool.end() - pool.begin(), static_cast<decltype(pool.end() - pool.begin())>(4u * count));
+
+    auto value = static_cast<int>(4u * count);
+
+    for(auto &&elem: pool) {
+        ASSERT_EQ(elem.value, --value);
+    }
+
+    for(auto next = 0u; next < 4u * count; next += 2u) {
+        pool.remove(entt::entity(next));
+    }
+
+    ASSERT_EQ(pool.size(), 2u * count);
+
+    for(auto next = 1u; next < 4u * count; next += 2u) {
+        ASSERT_EQ(pool.get(entt::entity(next)).value, static_cast<int>(next));
+    }
+
+    entt::storage<paged_int> other{std::move(pool)};
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(other.size(), 2u * count);
+    ASSERT_EQ(other.get(entt::entity{1}).value, 1);
+
+    pool = std::move(other);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(pool.size(), 2u * count);
+    ASSERT_EQ(pool.get(entt::entity(count)).value, static_cast<int>(count));
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
+TEST(Storage, Contiguous) {
+    entt::storage<boxed_int> pool;
+    entt::entity entities[64u];
+
+    pool.emplace(entt::entity{0}, 42);
+
+    for(auto next = 1u; next < 64u; ++next) {
+        // the argument is an object of the pool itself
+        pool.emplace(entt::entity(next), pool.get(entt::entity{0}));
+        entities[next] = entt::entity(64u + next);
+    }
+
+    pool.insert(std::begin(entities) + 1u, std::end(entities), pool.get(entt::entity{63}));
+
+    ASSERT_EQ(pool.size(), 127u);
+    ASSERT_EQ(pool.rend() - pool.rbegin(), 127);
+
+    for(auto pos = 0u; pos < pool.size(); ++pos) {
+        ASSERT_EQ(pool.raw()[pos].value, 42);
+        ASSERT_EQ(pool.raw() + pos, &pool.get(pool.data()[pos]));
+    }
+
+    pool.remove(std::begin(entities) + 1u, std::end(entities));
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.size(), 64u);
+    ASSERT_EQ(pool.raw() + pool.index(entt::entity{63}), &pool.get(entt::entity{63}));
+    ASSERT_EQ(pool.get(entt::entity{63}).value, 42);
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.raw(), nullptr);
+}
+
+TEST(Storage, Copy) {
+    entt::storage<boxed_int> pool;
+    entt::storage<stable_type> stable;
+    entt::storage<std::shared_ptr<int>> shared;
+    const auto count = 2u * ENTT_PACKED_PAGE + 1u;
+
+    for(auto next = 0u; next < count; ++next) {
+        pool.emplace(entt::entity(next), static_cast<int>(next));
+        stable.emplace(entt::entity(next), static_cast<int>(next));
+        shared.emplace(entt::entity(next), std::make_shared<int>(static_cast<int>(next)));
+    }
+
+    pool.remove(entt::entity{1u});
+    stable.remove(entt::entity{1u});
+    shared.remove(entt::entity{1u});
+
+    entt::storage<boxed_int> other{pool};
+    entt::storage<stable_type> other_stable{stable};
+    entt::storage<std::shared_ptr<int>> other_shared{shared};
+
+    ASSERT_EQ(other.size(), pool.size());
+    ASSERT_EQ(other_stable.size(), stable.size());
+    ASSERT_EQ(other_shared.size(), shared.size());
+    ASSERT_FALSE(other.contains(entt::entity{1u}));
+    ASSERT_FALSE(other_stable.contains(entt::entity{1u}));
+
+    for(auto next = 0u; next < count; ++next) {
+        if(next != 1u) {
+            ASSERT_EQ(other.get(entt::entity(next)), pool.get(entt::entity(next)));
+            ASSERT_NE(&other.get(entt::entity(next)), &pool.get(entt::entity(next)));
+            ASSERT_EQ(other.index(entt::entity(next)), pool.index(entt::entity(next)));
+            ASSERT_EQ(other_stable.get(entt::entity(next)).value, static_cast<int>(next));
+            ASSERT_EQ(other_shared.get(entt::entity(next)), shared.get(entt::entity(next)));
+        }
+    }
+
+    other.get(entt::entity{0u}).value = 42;
+
+    ASSERT_EQ(pool.get(entt::entity{0u}).value, 0);
+    ASSERT_EQ(shared.get(entt::entity{0u}).use_count(), 2);
+
+    other_stable.emplace(entt::entity(count));
+
+    ASSERT_EQ(other_stable.index(entt::entity(count)), 1u);
+
+    other.emplace(entt::entity(count));
+    other_shared.remove(entt::entity{0u});
+    other = pool;
+    other_shared = shared;
+
+    ASSERT_EQ(other.size(), pool.size());
+    ASSERT_FALSE(other.contains(entt::entity(count)));
+    ASSERT_EQ(other.get(entt::entity{0u}).value, 0);
+    ASSERT_EQ(other_shared.size(), shared.size());
+    ASSERT_EQ(shared.get(entt::entity{0u}).use_count(), 2);
+}
+
+TEST(Storage, InPlaceDeletion) {
+    entt::storage<stable_type> pool;
+    entt::entity entities[3u]{entt::entity{3}, entt::entity{42}, entt::entity{9}};
+
+    ASSERT_EQ(pool.policy(), entt::deletion_policy::in_place);
+    ASSERT_EQ(entt::storage<int>{}.policy(), entt::deletion_policy::swap_and_pop);
+
+    pool.emplace(entities[0u], 0);
+    pool.emplace(entities[1u], 1);
+    pool.emplace(entities[2u], 2);
+
+    const auto *first = &pool.get(entities[0u]);
+    const auto *last = &pool.get(entities[2u]);
+
+    pool.remove(entities[1u]);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_FALSE(pool.contains(entities[1u]));
+    ASSERT_EQ(&pool.get(entities[0u]), first);
+    ASSERT_EQ(&pool.get(entities[2u]), last);
+    ASSERT_EQ(pool.get(entities[2u]).value, 2);
+
+    pool.emplace(entities[1u], 42);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.index(entities[1u]), 1u);
+    ASSERT_EQ(pool.get(entities[1u]).value, 42);
+
+    pool.remove(entities[0u]);
+    pool.remove(entities[1u]);
+
+    ASSERT_EQ(&pool.get(entities[2u]), last);
+
+    pool.compact();
+
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(pool.index(entities[2u]), 0u);
+    ASSERT_EQ(pool.get(entities[2u]).value, 2);
+    ASSERT_EQ(pool.begin()->value, 2);
+
+    pool.emplace(entities[0u], 0);
+    pool.remove(entities[2u]);
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+}
+
 TEST(Storage, Iterator) {
     using iterator = typename entt::storage<boxed_int>::iterator;
 
@@ -649,3 +876,73 @@ TEST(Storage, ConstructorExceptionDoesNotAddToStorage) {
 
     ASSERT_TRUE(pool.empty());
 }
+
+TEST(Storage, ConstructorExceptionRollsBackInsert) {
+    entt::storage<copy_throwing_type> pool;
+    entt::entity entities[3u]{entt::entity{3}, entt::entity{42}, entt::entity{7}};
+    copy_throwing_type instance{};
+
+    copy_throwing_type::budget = 2;
+
+    try {
+        pool.insert(std::begin(entities), std::end(entities), instance);
+    } catch (const std::exception &) {
+        ASSERT_TRUE(pool.empty());
+    }
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(copy_throwing_type::live, 1);
+
+    copy_throwing_type instances[3u]{};
+    copy_throwing_type::budget = 1;
+
+    try {
+        pool.insert(std::begin(entities), std::end(entities), std::begin(instances), std::end(instances));
+    } catch (const std::exception &) {
+        ASSERT_TRUE(pool.empty());
+    }
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(copy_throwing_type::live, 4);
+}
+
+TEST(Storage, CopyExceptionLeavesEmpty) {
+    entt::storage<copy_throwing_type> pool;
+    entt::storage<copy_throwing_type> other;
+    entt::entity entities[3u]{entt::entity{3}, entt::entity{42}, entt::entity{7}};
+
+    copy_throwing_type::live = 0;
+    pool.emplace(entities[0u]);
+    pool.emplace(entities[1u]);
+    other.emplace(entities[1u]);
+    other.emplace(entities[2u]);
+    other.emplace(entities[0u]);
+    copy_throwing_type::budget = 1;
+
+    try {
+        pool = other;
+    } catch (const std::exception &) {
+        ASSERT_TRUE(pool.empty());
+    }
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_FALSE(pool.contains(entities[0u]));
+    ASSERT_FALSE(pool.contains(entities[1u]));
+    ASSERT_EQ(copy_throwing_type::live, 3);
+
+    copy_throwing_type::budget = 2;
+
+    try {
+        entt::storage<copy_throwing_type> copy{other};
+        FAIL();
+    } catch (const std::exception &) {
+        ASSERT_EQ(copy_throwing_type::live, 3);
+    }
+
+    copy_throwing_type::budget = 3;
+    pool = other;
+    pool.emplace(entt::entity{8});
+
+    ASSERT_EQ(pool.size(), 4u);
+    ASSERT_EQ(copy_throwing_type::live, 7);
+}
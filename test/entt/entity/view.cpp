@@ -1,12 +1,19 @@
+#include <atomic>
 #include <tuple>
 #include <utility>
 #include <type_traits>
 #include <gtest/gtest.h>
+#include <entt/core/thread_pool.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/view.hpp>
 
 struct empty_type {};
 
+struct stable_type {
+    static constexpr auto in_place_delete = true;
+    int value;
+};
+
 TEST(SingleComponentView, Functionalities) {
     entt::registry registry;
     auto view = registry.view<char>();
@@ -92,6 +99,24 @@ TEST(SingleComponentView, RawData) {
     ASSERT_EQ(cview.size(), 0u);
 }
 
+TEST(SingleComponentView, RawDataPaged) {
+    entt::registry registry;
+    auto view = registry.view<stable_type>();
+    auto cview = std::as_const(registry).view<const stable_type>();
+
+    static_assert(std::is_same_v<decltype(view.raw()), stable_type **>);
+    static_assert(std::is_same_v<decltype(cview.raw()), const stable_type * const *>);
+
+    registry.emplace<stable_type>(registry.create(), 42);
+
+    for(auto next = 0u; next < ENTT_PACKED_PAGE; ++next) {
+        registry.emplace<stable_type>(registry.create(), static_cast<int>(next));
+    }
+
+    ASSERT_EQ(view.raw()[0u][0u].value, 42);
+    ASSERT_EQ(cview.raw()[1u][0u].value, static_cast<int>(ENTT_PACKED_PAGE - 1u));
+}
+
 TEST(SingleComponentView, Invalid) {
     entt::registry registry{};
     auto eview = std::as_const(registry).view<const empty_type>();
@@ -214,6 +239,38 @@ TEST(SingleComponentView, Each) {
     ASSERT_EQ(cnt, std::size_t{0});
 }
 
+TEST(SingleComponentView, ParallelEach) {
+    entt::registry registry;
+    entt::thread_pool pool{2u};
+    entt::entity entities[10u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities), 1);
+    registry.insert<stable_type>(std::begin(entities), std::end(entities), stable_type{1});
+    registry.insert<empty_type>(std::begin(entities), std::end(entities));
+    registry.remove<stable_type>(entities[3u]);
+
+    std::atomic<int> sum{};
+    registry.view<int>().par_each([&sum](auto entity, int &value) { sum += (++value) + static_cast<int>(entt::to_integral(entity)); }, pool, 3u);
+
+    ASSERT_EQ(sum, 65);
+
+    registry.view<const int>().par_each([&sum](const int &value) { sum -= value; }, pool, 3u);
+    registry.view<stable_type>().par_each([&sum](auto, const stable_type &value) { sum -= value.value; }, pool, 3u);
+    registry.view<empty_type>().par_each([&sum](auto) { --sum; }, pool, 3u);
+    registry.view<empty_type>().par_each([&sum]() { --sum; }, pool);
+
+    ASSERT_EQ(sum, 16);
+
+    registry.view<int>().par_each([&sum](const int &) { ++sum; }, [](const std::size_t count, auto job) {
+        for(auto pos = count; pos; --pos) {
+            job(pos - 1u);
+        }
+    }, 1u);
+
+    ASSERT_EQ(sum, 26);
+}
+
 TEST(SingleComponentView, ConstNonConstAndAllInBetween) {
     entt::registry registry;
     auto view = registry.view<int>();
@@ -390,6 +447,44 @@ TEST(SingleComponentView, DeductionGuide) {
     static_assert(std::is_same_v<decltype(entt::basic_view{std::as_const(storage)}), entt::basic_view<entt::entity, entt::exclude_t<>, const int>>);
 }
 
+TEST(SingleComponentView, InPlaceDeletion) {
+    entt::registry registry;
+    auto view = registry.view<stable_type>();
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<stable_type>(entities[0u], 0);
+    registry.emplace<stable_type>(entities[1u], 1);
+    registry.emplace<stable_type>(entities[2u], 2);
+    registry.remove<stable_type>(entities[0u]);
+    registry.remove<stable_type>(entities[2u]);
+
+    ASSERT_EQ(view.size(), 3u);
+    ASSERT_EQ(view.front(), entities[1u]);
+    ASSERT_EQ(view.back(), entities[1u]);
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 1);
+    ASSERT_EQ(std::distance(view.rbegin(), view.rend()), 1);
+    ASSERT_EQ(*view.find(entities[1u]), entities[1u]);
+    ASSERT_EQ(view.find(entities[0u]), view.end());
+
+    std::size_t cnt{};
+    view.each([&cnt](const auto &component) { ++cnt; ASSERT_EQ(component.value, 1); });
+    view.each([&cnt](const auto entity, const auto &) { ++cnt; ASSERT_NE(entity, entt::entity{entt::null}); });
+
+    for(auto [entity, component]: view.each()) {
+        ASSERT_EQ(entity, entities[1u]);
+        ASSERT_EQ(component.value, 1);
+        ++cnt;
+    }
+
+    ASSERT_EQ(cnt, 3u);
+
+    registry.remove<stable_type>(entities[1u]);
+
+    ASSERT_TRUE(view.empty());
+    ASSERT_EQ(view.begin(), view.end());
+}
+
 TEST(MultiComponentView, Functionalities) {
     entt::registry registry;
     auto view = registry.view<int, char>();
@@ -431,6 +526,48 @@ TEST(MultiComponentView, Functionalities) {
     ASSERT_FALSE(invalid);
 }
 
+TEST(MultiComponentView, InPlaceDeletion) {
+    entt::registry registry;
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.insert<stable_type>(std::begin(entities), std::end(entities));
+    registry.remove<stable_type>(entities[1u]);
+
+    const auto view = registry.view<stable_type, int>();
+    const auto excluded = registry.view<stable_type>(entt::exclude<char>);
+
+    view.use<stable_type>();
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 2);
+    ASSERT_EQ(std::distance(excluded.begin(), excluded.end()), 2);
+
+    std::size_t cnt{};
+    view.each([&cnt](const auto entity, auto &&...) { ++cnt; ASSERT_NE(entity, entt::entity{entt::null}); });
+    excluded.each([&cnt](const auto entity, auto &&...) { ++cnt; ASSERT_NE(entity, entt::entity{entt::null}); });
+
+    ASSERT_EQ(cnt, 4u);
+}
+
+TEST(MultiComponentView, ParallelEach) {
+    entt::registry registry;
+    entt::thread_pool pool{2u};
+    entt::entity entities[10u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities), 1);
+    registry.insert<char>(std::begin(entities), std::begin(entities) + 5u, 'c');
+    registry.insert<empty_type>(std::begin(entities), std::begin(entities) + 8u);
+
+    std::atomic<int> sum{};
+    registry.view<int, char>().par_each([&sum](auto, int &value, char &) { sum += ++value; }, pool, 2u);
+    registry.view<int, empty_type>().par_each([&sum](const int &value) { sum += value; }, pool, 3u);
+    registry.view<empty_type, int>(entt::exclude<char>).par_each([&sum](auto, const int &value) { sum -= value; }, pool);
+
+    ASSERT_EQ(sum, 20);
+}
+
 TEST(MultiComponentView, Invalid) {
     entt::registry registry{};
     auto view = std::as_const(registry).view<const empty_type, const int>();
@@ -91,6 +91,24 @@ union union_t {
     double d;
 };
 
+template<std::size_t Index>
+struct indexed_t {
+    int value{static_cast<int>(Index)};
+    int get() const { return value; }
+};
+
+template<std::size_t... Index>
+void reflect_indexed(std::index_sequence<Index...>) {
+    (entt::meta<indexed_t<Index>>().type(entt::hashed_string::value("indexed") + static_cast<entt::id_type>(Index))
+        .template data<&indexed_t<Index>::value>(static_cast<entt::id_type>(Index))
+        .template func<&indexed_t<Index>::get>(static_cast<entt::id_type>(Index)), ...);
+}
+
+template<std::size_t... Index>
+void reset_indexed(std::index_sequence<Index...>) {
+    (entt::resolve<indexed_t<Index>>().reset(), ...);
+}
+
 struct MetaType: ::testing::Test {
     static void SetUpTestCase() {
         using namespace entt::literals;
@@ -556,6 +574,37 @@ TEST_F(MetaType, PropertiesAndCornerCases) {
     ASSERT_FALSE(type.data("list"_hs).prop(property_t::key_only).value());
 }
 
+TEST_F(MetaType, ResolveManyTypes) {
+    const auto id = [](const std::size_t index) { return entt::hashed_string::value("indexed") + static_cast<entt::id_type>(index); };
+    indexed_t<17u> instance{};
+    indexed_t<42u> other{};
+
+    reflect_indexed(std::make_index_sequence<64u>{});
+
+    ASSERT_EQ(entt::resolve(id(0u)), entt::resolve<indexed_t<0u>>());
+    ASSERT_EQ(entt::resolve(id(63u)), entt::resolve<indexed_t<63u>>());
+    ASSERT_EQ(entt::resolve(entt::type_id<indexed_t<42u>>()), entt::resolve<indexed_t<42u>>());
+    ASSERT_EQ(entt::resolve(id(17u)).data(17u).get(instance).cast<int>(), 17);
+    ASSERT_EQ(entt::resolve(id(17u)).func(17u).invoke(instance).cast<int>(), 17);
+    ASSERT_FALSE(entt::resolve(id(17u)).data(16u));
+    ASSERT_FALSE(entt::resolve(id(64u)));
+
+    reset_indexed(std::make_index_sequence<32u>{});
+
+    for(std::size_t pos{}; pos < 64u; ++pos) {
+        ASSERT_EQ(static_cast<bool>(entt::resolve(id(pos))), (pos >= 32u));
+    }
+
+    ASSERT_FALSE(entt::resolve(entt::type_id<indexed_t<0u>>()));
+    ASSERT_FALSE(entt::resolve<indexed_t<0u>>().data(0u));
+    ASSERT_EQ(entt::resolve(entt::type_id<indexed_t<42u>>()), entt::resolve<indexed_t<42u>>());
+    ASSERT_EQ(entt::resolve(id(42u)).data(42u).get(other).cast<int>(), 42);
+
+    reset_indexed(std::make_index_sequence<64u>{});
+
+    ASSERT_FALSE(entt::resolve(id(42u)));
+}
+
 TEST_F(MetaType, ResetAndReRegistrationAfterReset) {
     using namespace entt::literals;
 
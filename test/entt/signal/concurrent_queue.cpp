@@ -0,0 +1,228 @@
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/signal/concurrent_queue.hpp>
+
+struct aggregate_type {
+    int value;
+};
+
+struct throwing_type {
+    throwing_type(const int v)
+        : value{v}
+    {
+        if(value < 0) {
+            throw std::exception{};
+        }
+    }
+
+    throwing_type(const throwing_type &other)
+        : throwing_type{other.value}
+    {}
+
+    throwing_type(throwing_type &&) noexcept = default;
+
+    int value;
+};
+
+TEST(ConcurrentQueue, Functionalities) {
+    entt::concurrent_queue<int> queue;
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.size(), 0u);
+
+    for(int next{}; next < 1000; ++next) {
+        queue.emplace(next);
+    }
+
+    ASSERT_FALSE(queue.empty());
+    ASSERT_EQ(queue.size(), 1000u);
+
+    int expected{};
+
+    queue.drain([&expected](int &value) {
+        ASSERT_EQ(value, expected++);
+    });
+
+    ASSERT_EQ(expected, 1000);
+    ASSERT_TRUE(queue.empty());
+
+    queue.emplace(42);
+    queue.clear();
+
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(ConcurrentQueue, Segments) {
+    entt::concurrent_queue<int> queue;
+    std::size_t segments{};
+    std::size_t count{};
+
+    const auto visit = [&](int *first, int *last) {
+        ++segments;
+        count += static_cast<std::size_t>(last - first);
+    };
+
+    for(int next{}; next < 100; ++next) {
+        queue.emplace(next);
+    }
+
+    queue.drain(visit);
+
+    ASSERT_EQ(segments, 2u);
+    ASSERT_EQ(count, 100u);
+
+    queue.drain(visit);
+
+    ASSERT_EQ(segments, 2u);
+
+    queue.emplace(42);
+    queue.drain(visit);
+
+    ASSERT_EQ(segments, 3u);
+    ASSERT_EQ(count, 101u);
+}
+
+TEST(ConcurrentQueue, Aggregate) {
+    entt::concurrent_queue<aggregate_type> queue;
+    int sum{};
+
+    queue.emplace(42);
+    queue.drain([&sum](auto &instance) { sum += instance.value; });
+
+    ASSERT_EQ(sum, 42);
+}
+
+TEST(ConcurrentQueue, Insert) {
+    entt::concurrent_queue<int> queue;
+    std::vector<int> values(100u);
+
+    for(std::size_t pos{}; pos < values.size(); ++pos) {
+        values[pos] = static_cast<int>(pos);
+    }
+
+    queue.insert(values.begin(), values.end());
+    queue.insert(values.begin(), values.end());
+    queue.insert(values.begin(), values.begin());
+
+    ASSERT_EQ(queue.size(), 200u);
+
+    std::vector<int> drained;
+    queue.drain([&drained](int value) { drained.push_back(value); });
+
+    ASSERT_EQ(drained.size(), 200u);
+
+    for(std::size_t pos{}; pos < drained.size(); ++pos) {
+        ASSERT_EQ(drained[pos], static_cast<int>(pos % values.size()));
+    }
+}
+
+TEST(ConcurrentQueue, ThrowingConstructor) {
+    entt::concurrent_queue<throwing_type> queue;
+    const std::vector<throwing_type> range{throwing_type{1}, throwing_type{2}};
+    int expected{};
+
+    ASSERT_THROW(queue.emplace(-1), std::exception);
+    ASSERT_TRUE(queue.empty());
+
+    queue.emplace(0);
+    queue.insert(range.cbegin(), range.cend());
+
+    ASSERT_EQ(queue.size(), 3u);
+
+    // slots are claimed only for elements that were constructed
+    ASSERT_THROW(queue.emplace(-2), std::exception);
+    ASSERT_EQ(queue.size(), 3u);
+
+    queue.drain([&expected](auto &elem) {
+        ASSERT_EQ(elem.value, expected++);
+    });
+
+    ASSERT_EQ(expected, 3);
+}
+
+TEST(ConcurrentQueue, Destruction) {
+    auto value = std::make_shared<int>(42);
+
+    {
+        entt::concurrent_queue<std::shared_ptr<int>> queue;
+
+        for(auto next = 0u; next < 100u; ++next) {
+            queue.emplace(value);
+        }
+
+        ASSERT_EQ(value.use_count(), 101);
+
+        queue.drain([](auto &) {});
+
+        ASSERT_EQ(value.use_count(), 1);
+
+        queue.emplace(value);
+
+        ASSERT_EQ(value.use_count(), 2);
+    }
+
+    ASSERT_EQ(value.use_count(), 1);
+}
+
+TEST(ConcurrentQueue, Reentrant) {
+    entt::concurrent_queue<int> queue;
+    int count{};
+
+    queue.emplace(0);
+    queue.drain([&queue, &count](int value) {
+        ++count;
+        queue.emplace(value + 1);
+    });
+
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(queue.size(), 1u);
+
+    queue.drain([](int value) { ASSERT_EQ(value, 1); });
+
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(ConcurrentQueue, Concurrent) {
+    constexpr auto producers = 4u;
+    constexpr auto count = 10000u;
+    entt::concurrent_queue<std::size_t> queue;
+
+    for(auto round = 0u; round < 2u; ++round) {
+        std::vector<std::thread> threads;
+
+        for(auto id = 0u; id < producers; ++id) {
+            threads.emplace_back([&queue, id]() {
+                std::size_t batch[8u]{};
+
+                for(auto next = 0u; next < count; ++next) {
+                    if(next % 2u) {
+                        queue.emplace(std::size_t{id});
+                    } else {
+                        batch[next % 16u / 2u] = id;
+
+                        if(next % 16u == 14u) {
+                            queue.insert(std::begin(batch), std::end(batch));
+                        }
+                    }
+                }
+            });
+        }
+
+        for(auto &&thread: threads) {
+            thread.join();
+        }
+
+        std::vector<std::size_t> received(producers);
+        queue.drain([&received](const std::size_t id) { ++received[id]; });
+
+        for(auto id = 0u; id < producers; ++id) {
+            ASSERT_EQ(received[id], count);
+        }
+
+        ASSERT_TRUE(queue.empty());
+    }
+}
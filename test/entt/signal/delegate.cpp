@@ -1,4 +1,6 @@
+#include <cstddef>
 #include <memory>
+#include <utility>
 #include <gtest/gtest.h>
 #include <entt/signal/delegate.hpp>
 
@@ -399,3 +401,171 @@ TEST(Delegate, UnboundMemberFunction) {
 
     ASSERT_EQ(delegate(&functor, 3), 6);
 }
+
+TEST(OwningDelegate, Functionalities) {
+    entt::owning_delegate<int(int)> ff_del;
+    entt::owning_delegate<int(int)> mf_del;
+    entt::owning_delegate<int(int)> cl_del;
+    delegate_functor functor;
+    int offset = 1;
+
+    ASSERT_FALSE(ff_del);
+    ASSERT_EQ(ff_del, mf_del);
+
+    ff_del.connect<&delegate_function>();
+    mf_del.connect<&delegate_functor::operator()>(functor);
+    cl_del.connect([&offset](int value) { return value + offset; });
+
+    ASSERT_TRUE(ff_del);
+    ASSERT_TRUE(mf_del);
+    ASSERT_TRUE(cl_del);
+
+    ASSERT_EQ(ff_del(3), 9);
+    ASSERT_EQ(mf_del(3), 6);
+    ASSERT_EQ(cl_del(3), 4);
+
+    offset = 2;
+
+    ASSERT_EQ(cl_del(3), 5);
+
+    ASSERT_EQ(ff_del.instance(), nullptr);
+    ASSERT_EQ(mf_del.instance(), &functor);
+    ASSERT_EQ(cl_del.instance(), nullptr);
+
+    ASSERT_EQ(ff_del, (entt::owning_delegate<int(int)>{entt::connect_arg<&delegate_function>}));
+    ASSERT_NE(cl_del, ff_del);
+    ASSERT_NE(cl_del, entt::owning_delegate<int(int)>{cl_del});
+
+    cl_del.connect<&delegate_functor::operator()>(functor);
+
+    ASSERT_EQ(cl_del, mf_del);
+
+    cl_del.reset();
+
+    ASSERT_FALSE(cl_del);
+    ASSERT_EQ(cl_del, entt::owning_delegate<int(int)>{});
+}
+
+TEST(OwningDelegate, Target) {
+    auto closure = [value = 42](int) { return value; };
+    entt::owning_delegate<int(int)> delegate{closure};
+
+    ASSERT_NE(delegate.target<decltype(closure)>(), nullptr);
+    ASSERT_EQ(std::as_const(delegate).target<decltype(closure)>(), delegate.target<decltype(closure)>());
+    ASSERT_EQ(delegate.target<delegate_functor>(), nullptr);
+    ASSERT_EQ(delegate(0), 42);
+
+    delegate.connect(delegate_functor{});
+
+    ASSERT_EQ(delegate.target<decltype(closure)>(), nullptr);
+    ASSERT_NE(delegate.target<delegate_functor>(), nullptr);
+    ASSERT_EQ(delegate(3), 6);
+
+    delegate.connect([](const void *, int value) { return value; });
+
+    ASSERT_EQ(delegate.target<delegate_functor>(), nullptr);
+    ASSERT_EQ(delegate(3), 3);
+}
+
+TEST(OwningDelegate, Ownership) {
+    auto value = std::make_shared<int>(42);
+
+    {
+        entt::owning_delegate<int(int)> delegate{[value](int offset) { return *value + offset; }};
+
+        ASSERT_EQ(value.use_count(), 2);
+
+        auto other = delegate;
+
+        ASSERT_EQ(value.use_count(), 3);
+        ASSERT_EQ(other(1), 43);
+
+        auto last = std::move(other);
+
+        ASSERT_FALSE(other);
+        ASSERT_EQ(value.use_count(), 3);
+        ASSERT_EQ(last(2), 44);
+
+        other = last;
+
+        ASSERT_EQ(value.use_count(), 4);
+
+        other = std::move(delegate);
+
+        ASSERT_FALSE(delegate);
+        ASSERT_EQ(value.use_count(), 3);
+
+        last.connect<&delegate_function>();
+
+        ASSERT_EQ(value.use_count(), 2);
+        ASSERT_EQ(last(3), 9);
+    }
+
+    ASSERT_EQ(value.use_count(), 1);
+}
+
+TEST(OwningDelegate, InlineBuffer) {
+    std::size_t data[4u]{1u, 2u, 3u, 4u};
+    auto closure = [data]() { return data[1u]; };
+
+    entt::owning_delegate<std::size_t(), sizeof(data)> local{closure};
+    entt::owning_delegate<std::size_t(), 0u> heap{closure};
+    entt::owning_delegate<std::size_t()> small{[&data]() { return data[0u]; }};
+
+    const auto *first = reinterpret_cast<const char *>(&local);
+    const auto *target = reinterpret_cast<const char *>(local.target<decltype(closure)>());
+
+    ASSERT_GE(target, first);
+    ASSERT_LT(target, first + sizeof(local));
+
+    const auto *allocated = heap.target<decltype(closure)>();
+    auto other = std::move(heap);
+
+    ASSERT_NE(allocated, nullptr);
+    ASSERT_EQ(allocated, other.target<decltype(closure)>());
+    ASSERT_EQ(local(), 2u);
+    ASSERT_EQ(other(), 2u);
+    ASSERT_EQ(small(), 1u);
+
+    auto copy = small;
+    data[0u] = 42u;
+
+    ASSERT_EQ(small(), 42u);
+    ASSERT_EQ(copy(), 42u);
+}
+
+TEST(OwningDelegate, MutableState) {
+    entt::owning_delegate<int()> delegate{[counter = 0]() mutable { return ++counter; }};
+
+    ASSERT_EQ(delegate(), 1);
+    ASSERT_EQ(delegate(), 2);
+
+    auto other = delegate;
+
+    ASSERT_EQ(other(), 3);
+    ASSERT_EQ(delegate(), 3);
+}
+
+TEST(OwningDelegate, MoveOnlyType) {
+    entt::owning_delegate<int(std::unique_ptr<int>)> delegate{[](std::unique_ptr<int> ptr) { return *ptr; }};
+    auto ptr = std::make_unique<int>(42);
+
+    ASSERT_EQ(delegate(std::move(ptr)), 42);
+    ASSERT_EQ(ptr, nullptr);
+}
+
+TEST(OwningDelegate, DeductionGuide) {
+    int value = 0;
+
+    entt::owning_delegate func{entt::connect_arg<&delegate_function>};
+    entt::owning_delegate curried_func{entt::connect_arg<&curried_by_ref>, value};
+    entt::owning_delegate lambda{+[](const void *, int) { return 0; }};
+
+    static_assert(std::is_same_v<decltype(func), entt::owning_delegate<int(const int &)>>);
+    static_assert(std::is_same_v<typename decltype(curried_func)::type, int(int)>);
+    static_assert(std::is_same_v<typename decltype(lambda)::type, int(int)>);
+
+    ASSERT_TRUE(func);
+    ASSERT_TRUE(curried_func);
+    ASSERT_TRUE(lambda);
+}
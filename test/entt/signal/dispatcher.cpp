@@ -1,4 +1,7 @@
+#include <exception>
+#include <thread>
 #include <type_traits>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/type_traits.hpp>
 #include <entt/signal/dispatcher.hpp>
@@ -12,9 +15,25 @@ struct receiver {
         dispatcher.enqueue(event);
     }
 
+    static void nested(entt::dispatcher &dispatcher, an_event &event) {
+        dispatcher.enqueue(event);
+        dispatcher.update<an_event>();
+    }
+
+    static void nested_range(entt::dispatcher &dispatcher, an_event *, an_event *) {
+        dispatcher.queue<an_event>().emplace();
+        dispatcher.update<an_event>();
+    }
+
+    static void fail(const an_event &) {
+        throw std::exception{};
+    }
+
     void receive(const an_event &) { ++cnt; }
+    void receive_range(const an_event *first, const an_event *last) { cnt += static_cast<int>(last - first); ++ranges; }
     void reset() { cnt = 0; }
     int cnt{0};
+    int ranges{0};
 };
 
 TEST(Dispatcher, Functionalities) {
@@ -82,6 +101,112 @@ TEST(Dispatcher, StopAndGo) {
     ASSERT_EQ(receiver.cnt, 2);
 }
 
+TEST(Dispatcher, NestedUpdate) {
+    entt::dispatcher dispatcher;
+    receiver receiver;
+
+    dispatcher.sink<an_event>().connect<&receiver::nested>(dispatcher);
+    dispatcher.sink<an_event>().connect<&receiver::receive>(receiver);
+
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<an_event>();
+    dispatcher.update<an_event>();
+
+    ASSERT_EQ(receiver.cnt, 2);
+
+    dispatcher.sink<an_event>().disconnect<&receiver::nested>(dispatcher);
+    dispatcher.update<an_event>();
+
+    ASSERT_EQ(receiver.cnt, 4);
+}
+
+TEST(Dispatcher, NestedUpdateFromQueue) {
+    entt::dispatcher dispatcher;
+    receiver receiver;
+
+    dispatcher.range_sink<an_event>().connect<&receiver::nested_range>(dispatcher);
+    dispatcher.sink<an_event>().connect<&receiver::receive>(receiver);
+
+    dispatcher.queue<an_event>().emplace();
+    dispatcher.update<an_event>();
+
+    // the nested update returns immediately, the event it pushed is left for the next update
+    ASSERT_EQ(receiver.cnt, 1);
+    ASSERT_EQ(dispatcher.queue<an_event>().size(), 1u);
+
+    dispatcher.range_sink<an_event>().disconnect<&receiver::nested_range>(dispatcher);
+    dispatcher.update<an_event>();
+
+    ASSERT_EQ(receiver.cnt, 2);
+    ASSERT_TRUE(dispatcher.queue<an_event>().empty());
+}
+
+TEST(Dispatcher, ThrowingListener) {
+    entt::dispatcher dispatcher;
+    receiver receiver;
+
+    dispatcher.sink<an_event>().connect<&receiver::fail>();
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<an_event>();
+    dispatcher.queue<an_event>().emplace();
+
+    ASSERT_THROW(dispatcher.update<an_event>(), std::exception);
+
+    // the rest of the queued events is discarded, the concurrent queue is left for the next update
+    dispatcher.sink<an_event>().disconnect<&receiver::fail>();
+    dispatcher.sink<an_event>().connect<&receiver::receive>(receiver);
+    dispatcher.update<an_event>();
+
+    ASSERT_EQ(receiver.cnt, 1);
+    ASSERT_TRUE(dispatcher.queue<an_event>().empty());
+
+    dispatcher.enqueue<an_event>();
+    dispatcher.queue<an_event>().emplace();
+    dispatcher.update<an_event>();
+
+    ASSERT_EQ(receiver.cnt, 3);
+
+    dispatcher.sink<an_event>().connect<&receiver::fail>();
+    dispatcher.queue<an_event>().emplace();
+    dispatcher.queue<an_event>().emplace();
+
+    ASSERT_THROW(dispatcher.update<an_event>(), std::exception);
+    ASSERT_TRUE(dispatcher.queue<an_event>().empty());
+}
+
+TEST(Dispatcher, RangeSink) {
+    entt::dispatcher dispatcher;
+    receiver receiver;
+
+    dispatcher.sink<an_event>().connect<&receiver::forward>(dispatcher);
+    dispatcher.range_sink<an_event>().connect<&receiver::receive_range>(receiver);
+
+    dispatcher.trigger<an_event>();
+
+    ASSERT_EQ(receiver.cnt, 1);
+    ASSERT_EQ(receiver.ranges, 1);
+
+    for(auto count = 0u; count < 3u; ++count) {
+        dispatcher.queue<an_event>().emplace();
+    }
+
+    dispatcher.update<an_event>();
+
+    ASSERT_EQ(receiver.cnt, 5);
+    ASSERT_EQ(receiver.ranges, 3);
+
+    dispatcher.disconnect(dispatcher);
+    dispatcher.update<an_event>();
+
+    ASSERT_EQ(receiver.cnt, 9);
+    ASSERT_EQ(receiver.ranges, 4);
+
+    dispatcher.disconnect(receiver);
+    dispatcher.trigger<an_event>();
+
+    ASSERT_EQ(receiver.cnt, 9);
+}
+
 TEST(Dispatcher, OpaqueDisconnect) {
     entt::dispatcher dispatcher;
     receiver receiver;
@@ -96,3 +221,44 @@ TEST(Dispatcher, OpaqueDisconnect) {
 
     ASSERT_EQ(receiver.cnt, 1);
 }
+
+TEST(Dispatcher, Concurrent) {
+    entt::dispatcher dispatcher;
+    receiver receiver;
+
+    dispatcher.sink<an_event>().connect<&receiver::receive>(receiver);
+    auto &queue = dispatcher.queue<an_event>();
+    std::vector<std::thread> threads;
+
+    for(auto count = 0u; count < 4u; ++count) {
+        threads.emplace_back([&queue]() {
+            for(auto next = 0u; next < 1000u; ++next) {
+                queue.emplace();
+            }
+        });
+    }
+
+    for(auto &&thread: threads) {
+        thread.join();
+    }
+
+    dispatcher.enqueue<an_event>();
+
+    ASSERT_EQ(receiver.cnt, 0);
+
+    dispatcher.update<an_event>();
+
+    ASSERT_EQ(receiver.cnt, 4001);
+    ASSERT_TRUE(queue.empty());
+
+    queue.emplace();
+    dispatcher.clear<an_event>();
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 4001);
+
+    queue.emplace();
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 4002);
+}
@@ -1,3 +1,7 @@
+#include <array>
+#include <functional>
+#include <memory>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/type_traits.hpp>
 #include <entt/signal/emitter.hpp>
@@ -128,3 +132,125 @@ TEST(Emitter, OnAndErase) {
     ASSERT_TRUE(emitter.empty());
     ASSERT_TRUE(emitter.empty<bar_event>());
 }
+
+TEST(Emitter, StaleConnection) {
+    test_emitter emitter;
+    int counter{};
+
+    auto conn = emitter.on<foo_event>([&counter](auto &, auto &) { ++counter; });
+    emitter.erase(conn);
+
+    auto other = emitter.on<foo_event>([&counter](auto &, auto &) { counter += 2; });
+    emitter.erase(conn);
+    emitter.publish<foo_event>();
+
+    ASSERT_EQ(counter, 2);
+    ASSERT_FALSE(emitter.empty());
+
+    emitter.clear();
+    emitter.on<foo_event>([&counter](auto &, auto &) { counter += 3; });
+    emitter.erase(other);
+    emitter.publish<foo_event>();
+
+    ASSERT_EQ(counter, 5);
+    ASSERT_FALSE(emitter.empty());
+}
+
+TEST(Emitter, ManyListeners) {
+    test_emitter emitter;
+    std::vector<test_emitter::connection<foo_event>> conns;
+    int counter{};
+
+    for(auto next = 0u; next < 100u; ++next) {
+        conns.push_back(emitter.on<foo_event>([&counter](auto &, auto &) { ++counter; }));
+    }
+
+    emitter.publish<foo_event>();
+
+    ASSERT_EQ(counter, 100);
+
+    for(auto next = 0u; next < conns.size(); next += 2u) {
+        emitter.erase(conns[next]);
+    }
+
+    emitter.publish<foo_event>();
+
+    ASSERT_EQ(counter, 150);
+
+    for(auto next = 1u; next < conns.size(); next += 2u) {
+        emitter.erase(conns[next]);
+    }
+
+    ASSERT_TRUE(emitter.empty());
+}
+
+TEST(Emitter, ListenerStorage) {
+    test_emitter emitter;
+    auto value = std::make_shared<int>(0);
+    std::array<char, 64u> payload{};
+    payload[0u] = 'c';
+
+    auto conn = emitter.on<foo_event>([value, payload](foo_event &event, auto &) { *value += event.i; event.c = payload[0u]; });
+    emitter.on<foo_event>(std::function<void(foo_event &, test_emitter &)>{[value](auto &event, auto &) { *value += event.i; }});
+
+    ASSERT_EQ(value.use_count(), 3);
+
+    emitter.publish<foo_event>(21, 'a');
+
+    ASSERT_EQ(*value, 42);
+
+    emitter.erase(conn);
+
+    ASSERT_EQ(value.use_count(), 2);
+
+    emitter.clear();
+
+    ASSERT_EQ(value.use_count(), 1);
+
+    emitter.on<foo_event>([value](auto &, auto &) {});
+
+    {
+        test_emitter other{std::move(emitter)};
+        ASSERT_EQ(value.use_count(), 2);
+    }
+
+    ASSERT_EQ(value.use_count(), 1);
+}
+
+TEST(Emitter, ErasePublishing) {
+    test_emitter emitter;
+    test_emitter::connection<foo_event> conn{};
+    int counter{};
+
+    conn = emitter.on<foo_event>([&conn, &counter](auto &, auto &em) {
+        ++counter;
+        em.erase(conn);
+        em.template on<foo_event>([&counter](auto &, auto &) { counter += 10; });
+    });
+
+    emitter.once<foo_event>([&counter](auto &, auto &em) {
+        ++counter;
+        em.template publish<foo_event>();
+    });
+
+    emitter.publish<foo_event>();
+
+    // the nested publish reaches the new listener but not the short-lived one
+    ASSERT_EQ(counter, 12);
+    ASSERT_FALSE(emitter.empty());
+
+    emitter.publish<foo_event>();
+
+    ASSERT_EQ(counter, 22);
+}
+
+TEST(Emitter, Listener) {
+    test_emitter emitter;
+    int value{};
+
+    test_emitter::listener<foo_event> listener{[&value](foo_event &event, test_emitter &) { value = event.i; }};
+    emitter.on<foo_event>(listener);
+    emitter.publish<foo_event>(42, 'c');
+
+    ASSERT_EQ(value, 42);
+}
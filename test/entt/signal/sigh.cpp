@@ -1,8 +1,32 @@
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <gtest/gtest.h>
 #include <entt/signal/sigh.hpp>
 
+static std::size_t allocations{};
+
+void * operator new(std::size_t size) {
+    ++allocations;
+
+    if(void *ptr = std::malloc(size ? size : 1u); ptr) {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
 struct sigh_listener {
     static void f(int &v) { v = 42; }
 
@@ -442,3 +466,107 @@ TEST_F(SigH, UnboundMemberFunction) {
 
     ASSERT_TRUE(listener.k);
 }
+
+TEST_F(SigH, OwningDelegate) {
+    entt::sigh<void(int), entt::owning_delegate<void(int)>> sigh;
+    entt::sink sink{sigh};
+    before_after functor;
+    int sum{};
+
+    static_assert(std::is_same_v<decltype(sink), entt::sink<void(int), entt::owning_delegate<void(int)>>>);
+
+    sink.connect<&before_after::add>(functor);
+    auto conn = sink.connect([&sum](int value) { sum += value; });
+    sink.before(functor).connect([offset = 2](int value) { before_after::value += value + offset; });
+
+    ASSERT_EQ(sigh.size(), 3u);
+
+    sigh.publish(3);
+
+    ASSERT_EQ(functor.value, 8);
+    ASSERT_EQ(sum, 3);
+
+    auto other = sigh;
+    conn.release();
+    sigh.publish(1);
+
+    ASSERT_EQ(sigh.size(), 2u);
+    ASSERT_EQ(functor.value, 12);
+    ASSERT_EQ(sum, 3);
+
+    other.publish(1);
+
+    ASSERT_EQ(functor.value, 16);
+    ASSERT_EQ(sum, 4);
+
+    sink.disconnect(functor);
+
+    ASSERT_EQ(sigh.size(), 1u);
+
+    sink.disconnect();
+
+    ASSERT_TRUE(sigh.empty());
+    ASSERT_EQ(other.size(), 3u);
+}
+
+TEST_F(SigH, OwningDelegateInSitu) {
+    entt::sigh<void(int), entt::owning_delegate<void(int)>> sigh;
+    entt::sink sink{sigh};
+    int sum{};
+    int other{};
+
+    // the signal keeps the memory of its listeners once they are disconnected
+    sink.connect([](int) {}).release();
+
+    const auto count = allocations;
+    // tokens don't take space in the buffer, closures that capture two pointers are stored in place
+    sink.connect([&sum, &other](int value) { sum += value; other -= value; });
+
+    ASSERT_EQ(allocations, count);
+
+    sigh.publish(2);
+
+    ASSERT_EQ(sum, 2);
+    ASSERT_EQ(other, -2);
+}
+
+template<typename Sink, typename Func, typename = void>
+struct accepts_callable: std::false_type {};
+
+template<typename Sink, typename Func>
+struct accepts_callable<Sink, Func, std::void_t<decltype(std::declval<Sink &>().connect(std::declval<Func>()))>>: std::true_type {};
+
+TEST_F(SigH, OwningDelegateConnection) {
+    entt::sigh<void(int), entt::owning_delegate<void(int)>> sigh;
+    entt::sink sink{sigh};
+    int sum{};
+
+    const auto make = [&sum](const int step) {
+        return [&sum, step](int value) { sum += value * step; };
+    };
+
+    static_assert(accepts_callable<decltype(sink), decltype(make(0))>::value);
+    static_assert(!accepts_callable<entt::sink<void(int)>, decltype(make(0))>::value);
+
+    // callable objects of the same type are told apart by their connections
+    auto first = sink.connect(make(1));
+    auto second = sink.connect(make(10));
+    sink.connect(make(100));
+
+    sigh.publish(1);
+
+    ASSERT_EQ(sum, 111);
+
+    second.release();
+    sigh.publish(1);
+
+    ASSERT_EQ(sigh.size(), 2u);
+    ASSERT_EQ(sum, 212);
+
+    second.release();
+    first.release();
+    sigh.publish(1);
+
+    ASSERT_EQ(sigh.size(), 1u);
+    ASSERT_EQ(sum, 312);
+}